@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Instance.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class IndexBuffer;
+class VertexBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Render target recording draw commands to replay them later
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CommandBuffer : public RenderTarget
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty command buffer
+    ///
+    /// \a size should be the size of the target the commands will
+    /// be replayed on: it is what getSize() returns while recording,
+    /// and defines the default view, so that getViewport and the
+    /// coordinate mapping functions give the same results as on
+    /// that target. Culling is disabled, since the view which
+    /// will be active when the commands are replayed is not
+    /// known while recording them.
+    ///
+    /// \param size Size of the target the commands are meant for
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit CommandBuffer(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CommandBuffer() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CommandBuffer(CommandBuffer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    CommandBuffer& operator=(CommandBuffer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region of the target
+    ///
+    /// \return Size given at construction
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the render target for rendering
+    ///
+    /// A command buffer has no OpenGL context, all the draw
+    /// calls and clears are recorded instead.
+    ///
+    /// \param active Ignored
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setActive(bool active = true) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    /// The memory used by the commands is kept, so that the
+    /// next frame can be recorded without reallocating it.
+    /// The current view is not changed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// Every draw call, clear and view change is a command.
+    ///
+    /// \return Number of commands
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCommandCount() const;
+
+private:
+    friend class DrawQueue;
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of commands
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class CommandType
+    {
+        DrawVertices,      //!< Draw vertices stored in the command buffer
+        DrawVertexBuffer,  //!< Draw a range of a vertex buffer
+        DrawIndexedBuffer, //!< Draw a range of an index buffer
+        DrawInstances,     //!< Draw instances stored in the command buffer
+        Clear,             //!< Clear the target
+        SetView            //!< Change the current view
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded command
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        CommandType         type{};          //!< Type of command
+        RenderStates        states;          //!< Render states to use for drawing
+        PrimitiveType       primitiveType{}; //!< Type of primitives to draw
+        std::size_t         index{};         //!< Index of the first vertex, index or instance, or of the view to set
+        std::size_t         count{};         //!< Number of vertices, indices or instances to draw
+        const VertexBuffer* vertexBuffer{};  //!< Vertex buffer to draw, if any
+        const IndexBuffer*  indexBuffer{};   //!< Index buffer to draw, if any
+        Color               color;           //!< Color to clear the target with
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store primitives defined by an array of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    bool record(const Vertex*       vertices,
+                std::size_t         vertexCount,
+                PrimitiveType       type,
+                const RenderStates& states) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store primitives defined by a vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool record(const VertexBuffer& vertexBuffer,
+                std::size_t         firstVertex,
+                std::size_t         vertexCount,
+                const RenderStates& states) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store indexed primitives defined by a vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool record(const VertexBuffer& vertexBuffer,
+                const IndexBuffer&  indexBuffer,
+                std::size_t         firstIndex,
+                std::size_t         indexCount,
+                const RenderStates& states) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store instances of a vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool record(const VertexBuffer& vertexBuffer,
+                const Instance*     instances,
+                std::size_t         instanceCount,
+                const RenderStates& states) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a clear of the target
+    ///
+    ////////////////////////////////////////////////////////////
+    bool record(const Color& color) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a view change
+    ///
+    ////////////////////////////////////////////////////////////
+    void record(const View& view) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Execute a range of recorded commands on a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param first  Index of the first command to execute
+    /// \param count  Number of commands to execute
+    ///
+    ////////////////////////////////////////////////////////////
+    void replay(RenderTarget& target, std::size_t first, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the render states of a recorded command
+    ///
+    /// \param index Index of the command
+    ///
+    /// \return Render states used by the command
+    ///
+    ////////////////////////////////////////////////////////////
+    const RenderStates& getCommandStates(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u              m_size;      //!< Size of the target the commands are meant for
+    std::vector<Command>  m_commands;  //!< Recorded commands
+    std::vector<Vertex>   m_vertices;  //!< Vertices drawn by the commands
+    std::vector<Instance> m_instances; //!< Instances drawn by the commands
+    std::vector<View>     m_views;     //!< Views set by the commands
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CommandBuffer
+/// \ingroup graphics
+///
+/// All the drawing of a render target has to happen in the
+/// thread where its OpenGL context is active. Yet the costly
+/// part of drawing a scene is often on the CPU side: walking
+/// through the objects, culling them, and computing their
+/// geometry.
+///
+/// sf::CommandBuffer is a render target that doesn't render
+/// anything: drawables are drawn to it like to any other render
+/// target, but their primitives, render states and the view
+/// changes are only stored in memory owned by the buffer. It
+/// never touches OpenGL, so command buffers can be filled from
+/// worker threads, one buffer per thread, without any locking.
+/// The render thread then draws the command buffers to the real
+/// target, which replays them in one pass.
+///
+/// The vertices and instances are copied into the command
+/// buffer, so the drawables can be modified or destroyed as
+/// soon as they have been recorded. Textures, shaders, vertex
+/// buffers and index buffers are referenced and must be kept
+/// alive until the command buffer is replayed. Also note that drawing a sf::Text whose
+/// glyphs have not been loaded yet updates the font texture,
+/// which involves OpenGL even from a command buffer.
+///
+/// Recorded view changes and clears are applied to the target
+/// when the command buffer is replayed, as if the calls had
+/// been made directly on it.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::CommandBuffer> buffers;
+/// for (std::size_t i = 0; i < threadCount; ++i)
+///     buffers.emplace_back(window.getSize());
+///
+/// // In each worker thread
+/// sf::CommandBuffer& buffer = buffers[threadIndex];
+/// buffer.reset();
+/// buffer.setView(window.getView());
+/// for (const auto& entity : entitiesOfThisThread)
+///     if (isVisible(entity))
+///         buffer.draw(entity.sprite);
+///
+/// // In the render thread, once the workers are done
+/// window.clear();
+/// for (const auto& buffer : buffers)
+///     window.draw(buffer);
+/// window.display();
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::DrawQueue
+///
+////////////////////////////////////////////////////////////
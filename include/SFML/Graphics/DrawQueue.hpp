@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/CommandBuffer.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Drawable;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Deferred list of drawables, sorted to minimize render state changes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API DrawQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty queue.
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~DrawQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue(const DrawQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue& operator=(const DrawQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue(DrawQueue&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue& operator=(DrawQueue&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a drawable object to the queue
+    ///
+    /// The drawable is drawn right away, but its primitives are
+    /// only recorded: the drawable itself can be modified or
+    /// destroyed afterwards. Textures, shaders and vertex buffers
+    /// it uses must remain alive until the queue is drawn.
+    ///
+    /// Drawables of a lower layer are drawn before the ones of a
+    /// higher layer. Within a layer, the drawables are grouped by
+    /// render states (shader, texture and blend mode), and the ones
+    /// sharing the same states are drawn by increasing depth.
+    ///
+    /// \param drawable Object to draw
+    /// \param layer    Layer of the object
+    /// \param depth    Depth of the object within its layer
+    /// \param states   Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(const Drawable&     drawable,
+                int                 layer  = 0,
+                float               depth  = 0.f,
+                const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the content of the queue to a render target
+    ///
+    /// The queue is sorted, if needed, then drawn. It is not
+    /// cleared, so it can be drawn again.
+    ///
+    /// \param target Render target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the drawables from the queue
+    ///
+    /// The memory used by the queue is kept, so that the
+    /// next frame can be queued without reallocating it.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of drawables in the queue
+    ///
+    /// \return Number of drawables submitted since the last clear
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Drawable submitted to the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Item
+    {
+        int         layer{};        //!< Layer of the drawable
+        float       depth{};        //!< Depth of the drawable within its layer
+        std::size_t firstCommand{}; //!< Index of the first command recorded for the drawable
+        std::size_t commandCount{}; //!< Number of commands recorded for the drawable
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an item must be drawn before another one
+    ///
+    /// \param left  First item
+    /// \param right Second item
+    ///
+    /// \return True if \a left must be drawn before \a right
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isLess(const Item& left, const Item& right) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    CommandBuffer     m_commands;     //!< Primitives recorded for the drawables
+    std::vector<Item> m_items;        //!< Submitted drawables
+    bool              m_sorted{true}; //!< Are the items sorted?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DrawQueue
+/// \ingroup graphics
+///
+/// Every time two consecutive draw calls use a different
+/// texture, shader or blend mode, the render target has to
+/// change its OpenGL states, and consecutive primitives can't
+/// be merged when batching is enabled (see
+/// sf::RenderTarget::setBatchingEnabled). In many scenes, the
+/// order in which objects are drawn only matters between a few
+/// layers (background, entities, user interface, ...) and is
+/// arbitrary within each layer.
+///
+/// sf::DrawQueue takes advantage of this: drawables are submitted
+/// with a layer and a depth, and when the queue is drawn they are
+/// reordered so that, within each layer, the drawables sharing the
+/// same render states are drawn one after the other.
+///
+/// The primitives of each drawable are recorded when it is
+/// submitted, so the render states that are compared are the
+/// ones the drawable really uses (a sprite's texture, for example).
+/// The primitives of a single drawable are always drawn together
+/// and in their original order; drawables of a same layer that
+/// overlap and must be drawn in a given order should be given
+/// different layers.
+///
+/// Usage example:
+/// \code
+/// sf::DrawQueue queue;
+/// window.setBatchingEnabled(true);
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     queue.clear();
+///     queue.submit(background, 0);
+///     for (const auto& tree : trees)
+///         queue.submit(tree.sprite, 1);
+///     for (const auto& enemy : enemies)
+///         queue.submit(enemy.sprite, 1);
+///     queue.submit(scoreText, 2);
+///
+///     window.clear();
+///     queue.draw(window);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::Drawable
+///
+////////////////////////////////////////////////////////////
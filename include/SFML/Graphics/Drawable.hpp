@@ -29,6 +29,10 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 
+#include <SFML/Graphics/Rect.hpp>
+
+#include <optional>
+
 
 namespace sf
 {
@@ -64,6 +68,26 @@ protected:
     ///
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, const RenderStates& states) const = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the object
+    ///
+    /// The returned rectangle is expressed in the coordinate
+    /// system in which the drawable is drawn, i.e. before the
+    /// transform of the render states is applied. Render targets
+    /// use it to skip objects which are entirely outside of
+    /// the current view.
+    ///
+    /// The default implementation returns std::nullopt, which
+    /// means that the object is never culled.
+    ///
+    /// \return Bounding rectangle of the object, if known
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual std::optional<FloatRect> getCullingBounds() const
+    {
+        return std::nullopt;
+    }
 };
 
 } // namespace sf
@@ -77,7 +101,9 @@ protected:
 /// of derived classes to be drawn to a sf::RenderTarget.
 ///
 /// All you have to do in your derived class is to override the
-/// draw virtual function.
+/// draw virtual function. Derived classes which know their
+/// bounds can also override getCullingBounds, so that render
+/// targets can skip them when they are outside of the view.
 ///
 /// Note that inheriting from sf::Drawable is not mandatory,
 /// but it allows this nice syntax "window.draw(object)" rather
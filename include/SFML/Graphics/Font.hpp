@@ -33,7 +33,13 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/String.hpp>
+
+#include <array>
+#include <atomic>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -49,6 +55,7 @@ class ResourceStream;
 namespace sf
 {
 class InputStream;
+class Shader;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -66,6 +73,14 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    // Static member data
+    ////////////////////////////////////////////////////////////
+    // NOLINTBEGIN(readability-identifier-naming)
+    static constexpr unsigned int DistanceFieldCharacterSize{64}; //!< Size at which distance field glyphs are generated
+    static constexpr float        DistanceFieldSpread{8.f};       //!< Extent of the distance field around glyph edges
+    // NOLINTEND(readability-identifier-naming)
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -291,6 +306,59 @@ public:
     ////////////////////////////////////////////////////////////
     const Texture& getTexture(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize glyphs in advance in a background thread
+    ///
+    /// Glyphs are normally rasterized the first time they are
+    /// requested, which can stall the first frame displaying a
+    /// new text. This function starts rasterizing the glyphs of
+    /// \a characters at each of \a characterSizes in a background
+    /// thread instead. The rasterized glyphs are added to the
+    /// font's textures the next time the font is used (for
+    /// example when a sf::Text is drawn), with a single texture
+    /// update per character size.
+    ///
+    /// Glyphs requested before their rasterization is complete
+    /// are loaded immediately, as usual. Glyphs which are already
+    /// loaded are skipped. Glyphs still being prewarmed are not
+    /// copied along with the font.
+    ///
+    /// \param characters       Characters whose glyphs to rasterize
+    /// \param characterSizes   Character sizes at which to rasterize the glyphs
+    /// \param bold             Rasterize the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see isPrewarming, waitForPrewarm
+    ///
+    ////////////////////////////////////////////////////////////
+    void prewarm(const String&                     characters,
+                 const std::vector<unsigned int>& characterSizes,
+                 bool                             bold             = false,
+                 float                            outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether glyphs are still being prewarmed
+    ///
+    /// The glyphs whose rasterization is complete are added to
+    /// the font's textures by this function.
+    ///
+    /// \return True if some prewarmed glyphs are not yet available, false otherwise
+    ///
+    /// \see prewarm, waitForPrewarm
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPrewarming() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the prewarmed glyphs are rasterized
+    ///
+    /// The glyphs are then added to the font's textures.
+    ///
+    /// \see prewarm, isPrewarming
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForPrewarm() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
     ///
@@ -317,6 +385,81 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable distance field rendering
+    ///
+    /// By default, sf::Text rasterizes a separate set of glyphs
+    /// for every character size and outline thickness it is
+    /// drawn with, each character size having its own texture.
+    ///
+    /// When distance field rendering is enabled, sf::Text instead
+    /// uses a signed distance field of each glyph, generated once
+    /// at DistanceFieldCharacterSize into a single texture, and
+    /// reconstructs sharp edges with a shader at any character
+    /// size, scale or rotation. Outlines are limited to
+    /// DistanceFieldSpread pixels at DistanceFieldCharacterSize,
+    /// i.e. their thickness can't exceed
+    /// characterSize * DistanceFieldSpread / DistanceFieldCharacterSize.
+    ///
+    /// Distance field rendering requires shader support; when
+    /// shaders are not available, sf::Text keeps using the
+    /// regular glyphs.
+    /// Distance field rendering is disabled by default.
+    ///
+    /// \param enabled True to enable distance field rendering, false to disable it
+    ///
+    /// \see isDistanceFieldEnabled, getDistanceFieldGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether distance field rendering is enabled or not
+    ///
+    /// \return True if distance field rendering is enabled, false if it is disabled
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the distance field version of a glyph
+    ///
+    /// The metrics of the returned glyph are expressed at
+    /// DistanceFieldCharacterSize, and its bounds include the
+    /// DistanceFieldSpread margin surrounding the character.
+    /// The alpha channel of its texture rectangle holds the
+    /// signed distance to the glyph's edge, mapped so that
+    /// 0.5 lies on the edge and 0 and 1 lie DistanceFieldSpread
+    /// pixels outside and inside of it.
+    ///
+    /// Distance field glyphs are available regardless of
+    /// whether distance field rendering is enabled.
+    ///
+    /// \param codePoint Unicode code point of the character to get
+    /// \param bold      Retrieve the bold version or the regular one?
+    ///
+    /// \return The distance field glyph corresponding to \a codePoint
+    ///
+    /// \see getDistanceFieldTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the texture containing the loaded distance field glyphs
+    ///
+    /// The distance field texture is always smoothed, regardless
+    /// of the font's smooth filter.
+    ///
+    /// \return Texture containing the distance field glyphs
+    ///
+    /// \see getDistanceFieldGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getDistanceFieldTexture() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -328,6 +471,8 @@ public:
     Font& operator=(const Font& right);
 
 private:
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
     ///
@@ -343,10 +488,138 @@ private:
         unsigned int height;  //!< Height of the row
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Table mapping glyph keys to their glyph
+    ///
+    /// Glyphs are stored in an open addressing hash table. The
+    /// regular and bold glyphs of Latin-1 code points, without
+    /// outline, can also be looked up directly by code point.
+    /// References to the stored glyphs remain valid until the
+    /// table is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    class GlyphTable
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        GlyphTable() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        GlyphTable(const GlyphTable& copy);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        GlyphTable& operator=(const GlyphTable& right);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move operations
+        ///
+        ////////////////////////////////////////////////////////////
+        GlyphTable(GlyphTable&&) noexcept            = default;
+        GlyphTable& operator=(GlyphTable&&) noexcept = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Find a glyph by key
+        ///
+        /// \param key Key of the glyph, combining its index, boldness and outline thickness
+        ///
+        /// \return Pointer to the glyph, or a null pointer if it is not in the table
+        ///
+        ////////////////////////////////////////////////////////////
+        const Glyph* find(std::uint64_t key) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Find a Latin-1 glyph without outline by code point
+        ///
+        /// \param codePoint Code point of the glyph, must be lower than Latin1Size
+        /// \param bold      Find the bold version or the regular one?
+        ///
+        /// \return Pointer to the glyph, or a null pointer if it was not mapped
+        ///
+        ////////////////////////////////////////////////////////////
+        const Glyph* findLatin1(std::uint32_t codePoint, bool bold) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Add a glyph to the table, if its key isn't already present
+        ///
+        /// \param key   Key of the glyph
+        /// \param glyph Glyph to add
+        ///
+        /// \return The glyph stored in the table for \a key
+        ///
+        ////////////////////////////////////////////////////////////
+        const Glyph& insert(std::uint64_t key, const Glyph& glyph);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Map a Latin-1 code point to the glyph of a key, for direct lookup
+        ///
+        /// \param codePoint Code point of the glyph, must be lower than Latin1Size
+        /// \param bold      Map the bold version or the regular one?
+        /// \param key       Key of the glyph, which must be in the table
+        ///
+        ////////////////////////////////////////////////////////////
+        void mapLatin1(std::uint32_t codePoint, bool bold, std::uint64_t key);
+
+        static constexpr std::uint32_t Latin1Size{256}; //!< Number of code points which can be looked up directly
+
+    private:
+        ////////////////////////////////////////////////////////////
+        /// \brief Find the slot of a key, or the empty slot where it would be inserted
+        ///
+        /// \param key Key of the glyph
+        ///
+        /// \return Index of the slot
+        ///
+        ////////////////////////////////////////////////////////////
+        std::size_t findSlot(std::uint64_t key) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get a stored glyph
+        ///
+        /// \param index Index of the glyph, in insertion order
+        ///
+        /// \return Reference to the glyph
+        ///
+        ////////////////////////////////////////////////////////////
+        Glyph& getGlyph(std::uint32_t index) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Slot of the hash table
+        ///
+        ////////////////////////////////////////////////////////////
+        struct Slot
+        {
+            std::uint64_t key{};   //!< Key of the glyph
+            std::uint32_t index{}; //!< Index of the glyph plus one, 0 if the slot is empty
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Types
+        ////////////////////////////////////////////////////////////
+        static constexpr std::uint32_t ChunkSize{64}; //!< Number of glyphs allocated at once
+        using Chunk = std::array<Glyph, ChunkSize>;   //!< Glyphs allocated at once, never moved afterwards
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::vector<std::unique_ptr<Chunk>>       m_chunks;       //!< Storage of the glyphs, in insertion order
+        std::uint32_t                             m_glyphCount{}; //!< Number of stored glyphs
+        std::vector<Slot>                         m_slots;        //!< Hash table, its size is a power of two
+        std::array<std::uint32_t, Latin1Size * 2> m_latin1{};     //!< Glyph indices plus one of the Latin-1 code points
+    };
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    struct FontHandles;
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -356,12 +629,47 @@ private:
     {
         explicit Page(bool smooth);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
+        GlyphTable       glyphs;     //!< Table mapping glyph keys to their corresponding glyph
         Texture          texture;    //!< Texture containing the pixels of the glyphs
         unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
         std::vector<Row> rows;       //!< List containing the position of all the existing rows
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a glyph rasterized in memory, not yet stored in a page
+    ///
+    ////////////////////////////////////////////////////////////
+    struct RasterizedGlyph
+    {
+        unsigned int              characterSize{}; //!< Character size of the glyph
+        std::uint64_t             key{};           //!< Key of the glyph in its page
+        Glyph                     glyph;           //!< Glyph, its texture rectangle only holds its size
+        std::vector<std::uint8_t> pixels;          //!< Pixels of the glyph, including padding
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining glyphs being rasterized in a background thread
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PrewarmTask
+    {
+        PrewarmTask() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Stops the background thread and waits for it to finish.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~PrewarmTask();
+
+        PrewarmTask(PrewarmTask&&) noexcept            = default;
+        PrewarmTask& operator=(PrewarmTask&&) noexcept = default;
+
+        std::future<std::vector<RasterizedGlyph>> glyphs;    //!< Glyphs rasterized by the background thread
+        std::shared_ptr<std::atomic<bool>>        cancelled; //!< Tells the background thread to stop early
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Free all the internal resources
     ///
@@ -391,16 +699,83 @@ private:
     ////////////////////////////////////////////////////////////
     Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a glyph into a pixel buffer
+    ///
+    /// The font handles must be locked by the caller.
+    ///
+    /// \param fontHandles      Handles of the font to rasterize the glyph from
+    /// \param codePoint        Unicode code point of the character to rasterize
+    /// \param characterSize    Reference character size
+    /// \param bold             Rasterize the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param pixelBuffer      Buffer receiving the glyph's pixels, including padding
+    ///
+    /// \return The glyph, whose texture rectangle only holds the size of its pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    static Glyph rasterizeGlyph(FontHandles&               fontHandles,
+                                std::uint32_t              codePoint,
+                                unsigned int               characterSize,
+                                bool                       bold,
+                                float                      outlineThickness,
+                                std::vector<std::uint8_t>& pixelBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the glyphs rasterized by the completed prewarm tasks to their pages
+    ///
+    /// \param wait Wait for the tasks which are not complete yet?
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePrewarmedGlyphs(bool wait) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find or create the page holding the distance field glyphs
+    ///
+    /// \return The distance field glyphs page
+    ///
+    ////////////////////////////////////////////////////////////
+    Page& loadDistanceFieldPage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Generate a new distance field glyph and store it in the distance field page
+    ///
+    /// \param codePoint Unicode code point of the character to load
+    /// \param bold      Retrieve the bold version or the regular one?
+    ///
+    /// \return The distance field glyph corresponding to \a codePoint
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph loadDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader drawing distance field glyphs
+    ///
+    /// This function is used internally by sf::Text. The shaders
+    /// are shared between all copies of the font and are compiled
+    /// the first time they are requested. Each outline threshold,
+    /// rounded to 1/255, has its own shader, so that the returned
+    /// shader stays valid for any number of pending draws.
+    ///
+    /// \param outlineThreshold Distance value of the outline's edge (0.5 being the
+    ///                         glyphs' own edge), or std::nullopt to draw the glyphs' fill
+    ///
+    /// \return Shader drawing the glyphs, or a null pointer if it failed to compile
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getDistanceFieldShader(std::optional<float> outlineThreshold) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
-    /// \param page Page of glyphs to search in
-    /// \param size Width and height of the rectangle
+    /// \param page      Page of glyphs to search in
+    /// \param size      Width and height of the rectangle
+    /// \param minRowTop Minimum Y position of the row receiving the rectangle
     ///
     /// \return Found rectangle within the texture
     ///
     ////////////////////////////////////////////////////////////
-    IntRect findGlyphRect(Page& page, const Vector2u& size) const;
+    IntRect findGlyphRect(Page& page, const Vector2u& size, unsigned int minRowTop = 0) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
@@ -415,7 +790,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    struct FontHandles;
+    struct DistanceFieldShaders;
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
 
     ////////////////////////////////////////////////////////////
@@ -426,9 +801,14 @@ private:
     Info                         m_info;           //!< Information about the font
     mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    bool                                          m_distanceField{};      //!< Is distance field rendering enabled?
+    mutable std::optional<Page>                   m_distanceFieldPage;    //!< Distance field glyphs, created on demand
+    mutable std::shared_ptr<DistanceFieldShaders> m_distanceFieldShaders; //!< Shaders drawing distance field glyphs
+    std::uint64_t                                 m_generation{};         //!< Changes whenever the glyphs are replaced
 #ifdef SFML_SYSTEM_ANDROID
     std::unique_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
+    mutable std::vector<PrewarmTask> m_prewarmTasks; //!< Glyphs being rasterized in background threads, stopped first
 };
 
 } // namespace sf
@@ -123,6 +123,29 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromStream(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load several images from files on disk in parallel
+    ///
+    /// The files are decoded on a pool of worker threads, which
+    /// is much faster than calling loadFromFile in a loop when
+    /// many large images have to be loaded at once.
+    /// After the call, \a images contains one image per entry
+    /// of \a filenames, in the same order. Images whose file
+    /// could not be loaded are left empty.
+    ///
+    /// \param filenames   Paths of the image files to load
+    /// \param images      Array of images to fill
+    /// \param threadCount Number of threads to decode with, 0 to use one per hardware thread
+    ///
+    /// \return Number of images that were loaded successfully
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t loadFromFiles(const std::vector<std::filesystem::path>& filenames,
+                                                   std::vector<Image>&                       images,
+                                                   unsigned int                              threadCount = 0);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the image to a file on disk
     ///
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Structure describing one instance of an instanced draw
+///
+////////////////////////////////////////////////////////////
+struct SFML_GRAPHICS_API Instance
+{
+    Transform transform;           //!< Transform applied to the base geometry, on top of the render states' transform
+    Color     color{Color::White}; //!< Color modulating the vertex colors of the base geometry
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::Instance
+/// \ingroup graphics
+///
+/// sf::Instance holds the attributes of a single copy of the
+/// geometry drawn with sf::RenderTarget::drawInstanced. The
+/// same base geometry, stored in a sf::VertexBuffer, is drawn
+/// once per instance, transformed by the instance's transform
+/// and tinted by the instance's color.
+///
+/// Usage example:
+/// \code
+/// sf::VertexBuffer quad(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Static);
+/// ... // fill the quad's vertices
+///
+/// std::vector<sf::Instance> particles(10000);
+/// for (sf::Instance& particle : particles)
+/// {
+///     particle.transform.translate(...);
+///     particle.color = ...;
+/// }
+///
+/// window.drawInstanced(quad, particles.data(), particles.size(), &texture);
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
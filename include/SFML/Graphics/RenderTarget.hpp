@@ -37,12 +37,27 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <vector>
+
 #include <cstddef>
 
 
 namespace sf
 {
+namespace priv
+{
+class GpuTimer;
+class InstancedRenderer;
+class StreamingVertexBuffer;
+} // namespace priv
+
+class CommandBuffer;
 class Drawable;
+class IndexBuffer;
+struct Instance;
 class VertexBuffer;
 class Transform;
 
@@ -57,7 +72,7 @@ public:
     /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~RenderTarget() = default;
+    virtual ~RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
@@ -75,13 +90,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -297,6 +312,273 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// The vertices of \p vertexBuffer are assembled into primitives
+    /// in the order given by the indices of \p indexBuffer, using
+    /// the primitive type of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer referencing the vertices of \p vertexBuffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer referencing the vertices of \p vertexBuffer
+    /// \param firstIndex   Position of the first index to render in the index buffer
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replay the commands recorded in a command buffer
+    ///
+    /// The recorded draw calls and view changes are executed in
+    /// the order they were recorded, as if they had been made
+    /// directly on this render target.
+    ///
+    /// This function must be called from the thread where the
+    /// render target is used, and not while \p commandBuffer is
+    /// being recorded.
+    ///
+    /// \param commandBuffer Command buffer to replay
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CommandBuffer& commandBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many instances of the geometry of a vertex buffer
+    ///
+    /// The whole vertex buffer is drawn once per instance, with the
+    /// instance's transform combined with the transform of \a states
+    /// and the instance's color modulating the vertex colors.
+    ///
+    /// When the system supports hardware instancing and \a states
+    /// has no shader, all the instances are rendered with a single
+    /// instanced draw call through an internal shader. The instances
+    /// are kept in a buffer between calls, and only the ones which
+    /// changed since the previous call are uploaded again, so it is
+    /// cheap to draw the same instances every frame. Otherwise,
+    /// the instances are expanded on the CPU and drawn at once.
+    /// Expansion requires reading the vertex buffer back, which
+    /// is only done again when its contents change, and is not
+    /// possible with OpenGL ES; in this case each instance
+    /// is drawn separately and instance colors are ignored.
+    ///
+    /// \param vertexBuffer  Vertex buffer holding the geometry of a single instance
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const VertexBuffer& vertexBuffer,
+                       const Instance*     instances,
+                       std::size_t         instanceCount,
+                       const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive calls to
+    /// draw(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    /// -- which is what sprites, shapes, texts and vertex arrays
+    /// end up calling -- are not sent to the graphics card right
+    /// away. Their vertices are transformed on the CPU and
+    /// accumulated for as long as the texture, shader and blend
+    /// mode stay the same, and are then rendered with a single
+    /// draw call. Strips and fans are converted to their list
+    /// equivalent so that they can be merged too.
+    ///
+    /// The accumulated geometry is rendered when the render states
+    /// change, when the view changes, when clear(), display(),
+    /// pushGLStates() or resetGLStates() is called, when a vertex
+    /// buffer is drawn, or when flush() is called explicitly.
+    ///
+    /// Since drawing is deferred, the textures and shaders used
+    /// by pending draws must stay alive and unchanged until they
+    /// are flushed. In particular, call flush() before changing
+    /// the uniforms of a shader between two draws, before updating
+    /// a texture that was just drawn, and before issuing your own
+    /// OpenGL commands.
+    ///
+    /// Batching is disabled by default. Disabling it flushes
+    /// any pending geometry.
+    ///
+    /// \param enabled True to enable batching, false to disable it
+    ///
+    /// \see isBatchingEnabled, flush
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return True if batching is enabled, false otherwise
+    ///
+    /// \see setBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the geometry accumulated by batching
+    ///
+    /// This function does nothing if batching is disabled
+    /// or if there is no pending geometry.
+    ///
+    /// \see setBatchingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable streaming of vertices through a GPU buffer
+    ///
+    /// By default, draw(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    /// hands the vertices to OpenGL as client-side arrays, which
+    /// forces the driver to copy them synchronously on every call.
+    /// When streaming is enabled, the vertices are instead written
+    /// into a large ring buffer object. If the hardware supports
+    /// it, the buffer is mapped persistently and fences prevent
+    /// overwriting vertices that the GPU is still reading from;
+    /// otherwise the buffer is orphaned whenever it wraps around.
+    ///
+    /// Streaming is transparent to drawables, and draws with too
+    /// many vertices to fit in the ring buffer automatically
+    /// fall back to client-side arrays.
+    ///
+    /// Streaming is disabled by default, and can't be enabled
+    /// if vertex buffers are not available on the system.
+    ///
+    /// \param enabled True to enable streaming, false to disable it
+    ///
+    /// \see isVertexStreamingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexStreamingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether vertices are streamed through a GPU buffer
+    ///
+    /// \return True if vertex streaming is enabled, false otherwise
+    ///
+    /// \see setVertexStreamingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isVertexStreamingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable culling of drawables outside of the view
+    ///
+    /// When culling is enabled, draw(const Drawable&, const RenderStates&)
+    /// compares the bounds of the drawable, as returned by
+    /// Drawable::getCullingBounds and transformed by the render
+    /// states, with the area covered by the current view. Drawables
+    /// which are entirely outside of the view are skipped before
+    /// any of their vertices are processed.
+    ///
+    /// Only the outermost drawable that provides bounds is tested:
+    /// what it draws itself (such as the vertex array of a shape)
+    /// lies within its bounds and is not tested again.
+    ///
+    /// Drawables which don't provide bounds, as well as drawables
+    /// drawn with a shader (which may move vertices around), are
+    /// never culled.
+    ///
+    /// Culling is enabled by default.
+    ///
+    /// \param enabled True to enable culling, false to disable it
+    ///
+    /// \see isCullingEnabled, getStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether drawables outside of the view are culled
+    ///
+    /// \return True if culling is enabled, false otherwise
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rendering statistics of a render target
+    ///
+    /// All the counters are accumulated since the last call to
+    /// resetStatistics. Draws which are merged by batching are
+    /// only counted once they are actually submitted to OpenGL.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t drawnDrawables{};    //!< Number of drawables which were drawn, including nested ones
+        std::size_t culledDrawables{};   //!< Number of drawables skipped because they were outside of the view
+        std::size_t drawCalls{};         //!< Number of OpenGL draw calls
+        std::size_t vertices{};          //!< Number of vertices (or indices) submitted to OpenGL
+        std::size_t vertexCacheHits{};   //!< Number of draws with few enough vertices to be pre-transformed on the CPU
+        std::size_t vertexCacheMisses{}; //!< Number of draws with too many vertices to be pre-transformed on the CPU
+        std::size_t textureChanges{};    //!< Number of times a texture was bound or unbound
+        std::size_t shaderChanges{};     //!< Number of times a shader was bound or unbound
+        std::size_t blendModeChanges{};  //!< Number of times the blend mode was applied
+        std::size_t contextSwitches{};   //!< Number of times the target had to be activated in a context
+        Time        gpuTime;             //!< GPU time of the most recent frame which could be measured
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rendering statistics gathered since the last reset
+    ///
+    /// \return Rendering statistics of the render target
+    ///
+    /// \see resetStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the rendering statistics
+    ///
+    /// This function is typically called once per frame, after
+    /// the statistics of the previous frame have been read.
+    ///
+    /// It also marks the end of a frame for GPU timing: if timer
+    /// queries are supported and something was drawn to the
+    /// target, GPU timestamps are taken before the first command
+    /// that the target submits after a call to this function, and
+    /// at the next call. The \a gpuTime member reports the time
+    /// between them, which is the time the GPU took to process
+    /// the frame; unlike the interval between two frames, it
+    /// doesn't include the time the GPU spent waiting for the
+    /// next frame (e.g. for vertical synchronization). Frames are
+    /// measured from the first call to this function on; calling
+    /// it before display keeps the presentation out of the measure.
+    ///
+    /// Results are read back without stalling, so the \a gpuTime
+    /// member reports a frame which ended a few frames ago, and
+    /// stays zero when GPU timing is not available.
+    ///
+    /// \see getStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -408,7 +690,7 @@ protected:
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget() = default;
+    RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the common initialization step after creation
@@ -419,6 +701,106 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives instead of drawing them
+    ///
+    /// Derived classes which store draw commands to execute them
+    /// later, rather than rendering them, override this function.
+    /// It is called before the primitives are processed in any way.
+    /// The default implementation records nothing.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \return True if the primitives were recorded and mustn't be drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool record(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives of a vertex buffer instead of drawing them
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param firstVertex  Index of the first vertex to render
+    /// \param vertexCount  Number of vertices to render
+    /// \param states       Render states to use for drawing
+    ///
+    /// \return True if the primitives were recorded and mustn't be drawn
+    ///
+    /// \see record(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool record(const VertexBuffer& vertexBuffer,
+                        std::size_t         firstVertex,
+                        std::size_t         vertexCount,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record indexed primitives of a vertex buffer instead of drawing them
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer referencing the vertices of \p vertexBuffer
+    /// \param firstIndex   Position of the first index to render in the index buffer
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    /// \return True if the primitives were recorded and mustn't be drawn
+    ///
+    /// \see record(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool record(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record instances of a vertex buffer instead of drawing them
+    ///
+    /// \param vertexBuffer  Vertex buffer holding the geometry of a single instance
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    /// \return True if the instances were recorded and mustn't be drawn
+    ///
+    /// \see record(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool record(const VertexBuffer& vertexBuffer,
+                        const Instance*     instances,
+                        std::size_t         instanceCount,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a clear of the target instead of executing it
+    ///
+    /// \param color Fill color to use to clear the render target
+    ///
+    /// \return True if the clear was recorded and mustn't be executed
+    ///
+    /// \see record(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool record(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a view change
+    ///
+    /// This function is called after the current view has been
+    /// changed. The default implementation records nothing.
+    ///
+    /// \param view New view
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void record(const View& view);
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
@@ -458,6 +840,59 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, bypassing the batch
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives through the streaming vertex buffer
+    ///
+    /// The environment must already be set up for drawing.
+    ///
+    /// \param vertices    Pointer to the vertices, already pre-transformed if the vertex cache is used
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    ///
+    /// \return True if the primitives were drawn, false if they don't fit in the streaming buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool drawStreamedPrimitives(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw instances by expanding them on the CPU
+    ///
+    /// \param vertexBuffer  Vertex buffer holding the geometry of a single instance
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawExpandedInstances(const VertexBuffer& vertexBuffer,
+                               const Instance*     instances,
+                               std::size_t         instanceCount,
+                               const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the pending batch
+    ///
+    /// The pending batch is flushed first if it can't
+    /// be merged with the new primitives.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void batchVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -503,13 +938,44 @@ private:
         Vertex        vertexCache[VertexCacheSize]; //!< Pre-transformed vertices cache
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry accumulated while batching is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                enabled{};                      //!< Is batching enabled?
+        PrimitiveType       type{PrimitiveType::Triangles}; //!< Type of the pending primitives (never a strip or a fan)
+        RenderStates        states;                         //!< Render states of the pending primitives
+        std::uint64_t       textureId{};                    //!< Cache identifier of the pending texture
+        std::vector<Vertex> vertices;                       //!< Pending pre-transformed vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry read back from a vertex buffer to expand instances
+    ///
+    ////////////////////////////////////////////////////////////
+    struct InstanceGeometry
+    {
+        std::uint64_t       cacheId{}; //!< Cache identifier of the vertex buffer contents the geometry was read from
+        std::vector<Vertex> vertices;  //!< Vertices read back from the vertex buffer
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                                         m_defaultView;          //!< Default view
+    View                                         m_view;                 //!< Current view
+    StatesCache                                  m_cache{};              //!< Render states cache
+    Batch                                        m_batch;                //!< Pending batched geometry
+    InstanceGeometry                             m_instanceGeometry;     //!< Geometry of the last expanded instances
+    std::unique_ptr<priv::StreamingVertexBuffer> m_streamingBuffer;      //!< Vertex streaming ring buffer, if enabled
+    std::unique_ptr<priv::InstancedRenderer>     m_instancedRenderer;    //!< Hardware instancing support, if used
+    std::unique_ptr<priv::GpuTimer>              m_gpuTimer;             //!< GPU frame timing, if supported and used
+    bool                                         m_cullingEnabled{true}; //!< Are drawables outside of the view culled?
+    std::size_t                                  m_testedDrawables{};    //!< Depth of culling-tested nested draws
+    Statistics                                   m_statistics;           //!< Rendering statistics since the last reset
+    std::uint64_t                                m_id{};                 //!< Unique number identifying the RenderTarget
 };
 
 } // namespace sf
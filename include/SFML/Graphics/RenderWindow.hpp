@@ -176,6 +176,17 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window's contents are displayed
+    ///
+    /// Any geometry still pending in the draw batch is rendered
+    /// (see RenderTarget::setBatchingEnabled), so that the frame
+    /// is complete whether display() is called through a
+    /// RenderWindow or through a Window reference.
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -30,6 +30,7 @@
 #include <SFML/Graphics/Export.hpp>
 
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
@@ -230,6 +231,10 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// If the font uses distance field rendering, the thickness
+    /// is limited to the spread of the distance field, see
+    /// sf::Font::setDistanceFieldEnabled.
+    ///
     /// \param thickness New outline thickness, in pixels
     ///
     /// \see getOutlineThickness
@@ -394,15 +399,60 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, const RenderStates& states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the text
+    ///
+    /// \return Bounding rectangle of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<FloatRect> getCullingBounds() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure the text's geometry is updated
     ///
     /// All the attributes related to rendering are cached, such
     /// that the geometry is only updated when necessary.
+    /// The glyphs and kerning of each character are cached
+    /// as well, and only the characters following the first
+    /// change of the string are laid out again.
     ///
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the cached glyphs and layout of all the characters
+    ///
+    /// This function must be called when a change affects which
+    /// glyphs are used, such as the font or the character size.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateShaping();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the cached layout of all the characters, but keep their glyphs
+    ///
+    /// This function must be called when a change affects how
+    /// glyphs are positioned, such as the letter spacing.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateLayout();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached glyphs and layout of a character of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CharacterLayout
+    {
+        float       kerning{};            //!< Kerning offset with the previous character
+        Glyph       glyph;                //!< Glyph of the character
+        Glyph       outlineGlyph;         //!< Glyph of the character's outline
+        Vector2f    position;             //!< Position of the next character
+        Vector2f    boundsMin;            //!< Minimum coordinates of the geometry up to this character
+        Vector2f    boundsMax;            //!< Maximum coordinates of the geometry up to this character
+        std::size_t vertexCount{};        //!< Number of fill vertices up to this character
+        std::size_t outlineVertexCount{}; //!< Number of outline vertices up to this character
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -417,9 +467,11 @@ private:
     float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
     mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable FloatRect     m_bounds;                       //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool          m_geometryNeedUpdate{};         //!< Does the geometry need to be recomputed?
+    mutable std::uint64_t m_fontGeneration{};             //!< Generation of the font glyphs the geometry was built from
+    mutable std::vector<CharacterLayout> m_layout;        //!< Cached glyphs and layout of the leading characters
+    mutable std::size_t                  m_layoutValid{}; //!< Number of leading characters whose layout is valid
 };
 
 } // namespace sf
@@ -458,6 +510,13 @@ private:
 /// used by a sf::Text (i.e. never write a function that
 /// uses a local sf::Font instance for creating a text).
 ///
+/// If distance field rendering is enabled on the font (see
+/// sf::Font::setDistanceFieldEnabled), texts of any character
+/// size share the font's distance field glyphs and are drawn
+/// with an internal shader, which stays sharp when the text is
+/// scaled. A shader given in the render states replaces the
+/// internal one and receives the distance field texture.
+///
 /// See also the note on coordinates and undistorted rendering in sf::Transformable.
 ///
 /// Usage example:
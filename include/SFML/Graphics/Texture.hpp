@@ -34,6 +34,8 @@
 #include <SFML/Window/GlResource.hpp>
 
 #include <filesystem>
+#include <memory>
+#include <vector>
 
 
 namespace sf
@@ -44,6 +46,12 @@ class RenderTexture;
 class Text;
 class Window;
 class Image;
+class TextureReadback;
+
+namespace priv
+{
+class TextureUploader;
+} // namespace priv
 
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
@@ -147,6 +155,30 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename, const IntRect& area = IntRect());
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load several textures from image files on disk
+    ///
+    /// The files are decoded in parallel on a pool of worker
+    /// threads (see Image::loadFromFiles), then all the pixels
+    /// are uploaded to the graphics card in a single pass on
+    /// the calling thread.
+    /// After the call, \a textures contains one texture per entry
+    /// of \a filenames, in the same order. Textures whose file
+    /// could not be loaded are left empty.
+    ///
+    /// \param filenames   Paths of the image files to load
+    /// \param textures    Array of textures to fill
+    /// \param threadCount Number of threads to decode with, 0 to use one per hardware thread
+    ///
+    /// \return Number of textures that were loaded successfully
+    ///
+    /// \see loadFromFile, Image::loadFromFiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t loadFromFiles(const std::vector<std::filesystem::path>& filenames,
+                                                   std::vector<Texture>&                     textures,
+                                                   unsigned int                              threadCount = 0);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the texture from a file in memory
     ///
@@ -238,6 +270,71 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromImage(const Image& image, const IntRect& area = IntRect());
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image file on disk
+    ///
+    /// The supported containers are DDS (DXT1, DXT5 and DX10
+    /// BC1/BC3/BC7 formats) and uncompressed KTX2 (BC1, BC3,
+    /// BC7 and ETC2 RGBA8 formats). Only the top mipmap level
+    /// of the file is loaded.
+    ///
+    /// If the graphics card supports the format, the blocks are
+    /// uploaded as is: the texture then uses 4 to 8 times less
+    /// video memory than an uncompressed one, and loading skips
+    /// the decoding step entirely. Otherwise, the image is
+    /// decompressed on the CPU and loaded like any other image.
+    ///
+    /// The sRGB flag stored in the file is ignored, use setSrgb
+    /// before loading to select the sRGB variant of the format.
+    ///
+    /// Compressed textures can't be modified: calling the update
+    /// functions on a texture stored compressed by the graphics
+    /// card results in an OpenGL error.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param filename Path of the compressed image file to load
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see loadFromCompressedMemory, loadFromCompressedStream, loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image file in memory
+    ///
+    /// See loadFromCompressedFile for the supported formats.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see loadFromCompressedFile, loadFromCompressedStream, loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image in a custom stream
+    ///
+    /// See loadFromCompressedFile for the supported formats.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see loadFromCompressedFile, loadFromCompressedMemory, loadFromStream
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedStream(InputStream& stream);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the texture
     ///
@@ -261,6 +358,25 @@ public:
     ////////////////////////////////////////////////////////////
     Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture pixels to an image, asynchronously
+    ///
+    /// Unlike copyToImage, this function doesn't wait for the
+    /// graphics card: the download is queued and runs in the
+    /// background. The returned object can be polled with
+    /// TextureReadback::isReady, and the image retrieved with
+    /// TextureReadback::getImage once the pixels have arrived.
+    ///
+    /// The image contains the pixels of the texture as they are
+    /// at the time of the call, later updates don't affect it.
+    ///
+    /// \return Readback which produces the texture's pixels
+    ///
+    /// \see copyToImage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback copyToImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
@@ -299,6 +415,68 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole texture from an array of pixels, asynchronously
+    ///
+    /// This function works like update(const std::uint8_t*), except
+    /// that it doesn't stall the pipeline: the pixels are copied to a
+    /// staging buffer on the graphics card and the texture is updated
+    /// from it while rendering goes on. The \a pixels array can be
+    /// reused or freed as soon as the function returns.
+    ///
+    /// This is well suited to textures that are updated every frame
+    /// with a lot of data, such as video frames. If the system doesn't
+    /// support pixel buffer objects, this function falls back to a
+    /// regular update.
+    ///
+    /// Draws issued after this call use the new pixels. To use the
+    /// texture from another context, call waitForUpdate first.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    ///
+    /// \see isUpdateComplete, waitForUpdate
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAsync(const std::uint8_t* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels, asynchronously
+    ///
+    /// This function works like update(const std::uint8_t*, const Vector2u&, const Vector2u&),
+    /// except that it doesn't stall the pipeline (see updateAsync(const std::uint8_t*)).
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in \a pixels
+    /// \param dest   Coordinates of the destination position
+    ///
+    /// \see isUpdateComplete, waitForUpdate
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAsync(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether all the asynchronous updates have completed
+    ///
+    /// This function never blocks. It returns true when the graphics
+    /// card is done copying the pixels of every previous call to
+    /// updateAsync into the texture. If completion can't be tracked
+    /// on this system, updates are considered complete once issued.
+    ///
+    /// \return True if no asynchronous update is pending
+    ///
+    /// \see updateAsync, waitForUpdate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isUpdateComplete() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the asynchronous updates have completed
+    ///
+    /// \see updateAsync, isUpdateComplete
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForUpdate() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -596,6 +774,7 @@ private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureReadback;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -634,6 +813,8 @@ private:
     bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool          m_hasMipmap{};     //!< Has the mipmap been generated?
     std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+
+    std::unique_ptr<priv::TextureUploader> m_uploader; //!< Staging buffers for asynchronous updates
 };
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Image;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Collection of images packed into a few large textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas
+    ///
+    /// Pages are created with \p pageSize and grown, up to the
+    /// maximum texture size, when they can't hold new images.
+    ///
+    /// \param pageSize Initial size of the textures of the atlas
+    /// \param padding  Number of transparent pixels kept around each image
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(const Vector2u& pageSize = {512, 512}, unsigned int padding = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The image is copied into the first page that has enough
+    /// free space, growing the pages or creating a new one if
+    /// needed. The returned identifier is then used to retrieve
+    /// the texture and texture rectangle of the image.
+    ///
+    /// If the image can't be added, the atlas is left unchanged.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Identifier of the image, or std::nullopt if it couldn't be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an image from the atlas
+    ///
+    /// The space used by the image is only reclaimed when
+    /// the atlas is repacked.
+    ///
+    /// \param id Identifier of the image to remove
+    ///
+    /// \see repack
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an identifier refers to an image of the atlas
+    ///
+    /// \param id Identifier to check
+    ///
+    /// \return True if the image is in the atlas, false if it was removed or never added
+    ///
+    ////////////////////////////////////////////////////////////
+    bool contains(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture containing an image
+    ///
+    /// The texture remains the same when its page grows, so
+    /// sprites using it don't have to be updated.
+    ///
+    /// \param id Identifier of the image, it must be in the atlas
+    ///
+    /// \return Texture containing the image
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of the texture containing an image
+    ///
+    /// The rectangle can be passed directly to Sprite::setTextureRect.
+    /// It remains valid until the atlas is repacked.
+    ///
+    /// \param id Identifier of the image, it must be in the atlas
+    ///
+    /// \return Texture rectangle of the image
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getTextureRect(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack the images of the atlas again
+    ///
+    /// Reclaims the space of removed images and rearranges the
+    /// remaining ones, from the tallest to the smallest, which
+    /// usually produces tighter and fewer pages. The identifiers
+    /// remain valid but the texture rectangles change, so they
+    /// have to be retrieved again. The textures of the pages are
+    /// reused, and pages are never destroyed: if the images need
+    /// fewer pages than before, the last pages are emptied and
+    /// shrunk to the initial page size, so that sprites still
+    /// referring to their textures remain valid.
+    ///
+    /// If repacking fails, the atlas is left unchanged.
+    ///
+    /// \return True if repacking was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool repack();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the images and destroy the pages of the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pages of the atlas
+    ///
+    /// \return Number of textures used by the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a page of the atlas
+    ///
+    /// \param index Index of the page, must be lower than getPageCount()
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getPageTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of the pages
+    ///
+    /// Since neighbour images are separated by the padding,
+    /// the smooth filter should only be used with a padding of
+    /// at least 1 pixel. The default is false.
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isSmooth() const;
+
+private:
+    struct Page;
+    struct Allocation;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::size_t page{};    //!< Index of the page containing the image
+        IntRect     rect;      //!< Texture rectangle of the image
+        bool        removed{}; //!< Was the image removed from the atlas?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a place for a rectangle in a list of pages
+    ///
+    /// The pages are left untouched: the returned allocation holds
+    /// the packer of the page, grown or new if necessary, with the
+    /// rectangle placed in it.
+    ///
+    /// \param pages List of pages
+    /// \param size  Size of the rectangle, padding included
+    ///
+    /// \return Place found for the rectangle, or std::nullopt if there's no room
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<Allocation> allocate(const std::vector<std::unique_ptr<Page>>& pages, const Vector2u& size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the texture of a page
+    ///
+    /// The current content of the texture is preserved, and
+    /// the texture is left unchanged on failure.
+    ///
+    /// \param page Page to update
+    /// \param size New size of the texture
+    ///
+    /// \return True if the texture was successfully resized
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resizeTexture(Page& page, const Vector2u& size) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                           m_pageSize;   //!< Initial size of the pages
+    unsigned int                       m_padding;    //!< Number of pixels kept around each image
+    bool                               m_isSmooth{}; //!< Status of the smooth filter
+    std::vector<std::unique_ptr<Page>> m_pages;      //!< Pages of the atlas
+    std::vector<Entry>                 m_entries;    //!< Location of the images, indexed by identifier
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Switching textures between draw calls is costly, and it
+/// prevents consecutive sprites from being batched together.
+/// sf::TextureAtlas reduces the number of textures needed by
+/// copying many small images into a few large textures, called
+/// pages, and giving back where each image ended up.
+///
+/// Images can be added at any time. They are placed with a
+/// skyline packer, which keeps the pages dense even when the
+/// images have very different sizes. When a page is full it
+/// is first grown, keeping the images already placed where
+/// they are, and a new page is only created once the maximum
+/// texture size has been reached.
+///
+/// Removed images leave holes in the pages; repack() gets
+/// rid of them by placing all the remaining images again.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// // Add the images to the atlas
+/// const std::optional<std::size_t> player = atlas.add(playerImage);
+/// const std::optional<std::size_t> enemy  = atlas.add(enemyImage);
+/// if (!player || !enemy)
+///     return -1;
+///
+/// // Use them with sprites
+/// sf::Sprite playerSprite(atlas.getTexture(*player), atlas.getTextureRect(*player));
+/// sf::Sprite enemySprite(atlas.getTexture(*enemy), atlas.getTextureRect(*enemy));
+///
+/// // Both sprites share the same texture
+/// window.draw(playerSprite);
+/// window.draw(enemySprite);
+/// \endcode
+///
+/// \see sf::Texture, sf::Image, sf::Sprite
+///
+////////////////////////////////////////////////////////////
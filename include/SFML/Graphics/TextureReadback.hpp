@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <memory>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pending download of a texture's pixels to an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a readback which is ready and holds an empty image.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels have arrived
+    ///
+    /// This function never blocks. Once it returns true,
+    /// getImage can be called without stalling.
+    ///
+    /// \return True if the image can be retrieved without waiting
+    ///
+    /// \see getImage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the image containing the texture's pixels
+    ///
+    /// If the pixels haven't arrived yet, this function waits
+    /// for them. The image is only built on the first call,
+    /// subsequent calls return the same image.
+    ///
+    /// \return Image containing the pixels of the texture at
+    ///         the time the readback was issued
+    ///
+    /// \see isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    const Image& getImage();
+
+private:
+    friend class Texture;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start downloading the pixels of a texture
+    ///
+    /// \param texture Texture to read from
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureReadback(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct PixelBuffer;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<PixelBuffer> m_pixelBuffer; //!< Buffer the pixels are downloaded to, until they are read back
+    Image                        m_image;       //!< Image built from the downloaded pixels
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// sf::Texture::copyToImage downloads the pixels of a texture
+/// synchronously, which forces the CPU to wait until the GPU
+/// has finished all the rendering that was queued before.
+///
+/// sf::TextureReadback, obtained with Texture::copyToImageAsync,
+/// lets the download run in the background instead: the pixels
+/// are copied into a pixel buffer object on the graphics card,
+/// and only read back when the image is requested. Polling
+/// isReady() once per frame and retrieving the image when it
+/// returns true never stalls the pipeline.
+///
+/// If the system doesn't support pixel buffer objects, the
+/// pixels are downloaded immediately and the readback is
+/// ready right away.
+///
+/// Usage example:
+/// \code
+/// // Take a screenshot of a render texture without stalling
+/// std::optional<sf::TextureReadback> screenshot = renderTexture.getTexture().copyToImageAsync();
+///
+/// // Later, once per frame
+/// if (screenshot && screenshot->isReady())
+/// {
+///     if (!screenshot->getImage().saveToFile("screenshot.png"))
+///         return -1;
+///     screenshot.reset();
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
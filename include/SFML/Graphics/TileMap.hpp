@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of textured tiles stored in GPU chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map
+    ///
+    /// The tiles are grouped into chunks of \p chunkSize tiles,
+    /// each stored in its own vertex buffer. Only the chunks which
+    /// intersect the current view are drawn, and changing a tile
+    /// only uploads the vertices of that tile.
+    ///
+    /// \param mapSize   Number of tiles in each direction
+    /// \param tileSize  Size of a tile, in local units
+    /// \param chunkSize Number of tiles in each direction of a chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Vector2u& mapSize, const Vector2f& tileSize, const Vector2u& chunkSize = {32, 32});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of the tiles
+    ///
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the tile map uses it. If \a texture is
+    /// a null pointer, the tiles are drawn with their color only.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of the tiles
+    ///
+    /// \return Pointer to the texture, or null if there is none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set a tile
+    ///
+    /// Only the vertices of the tile are sent to the graphics
+    /// card, the next time that the map is drawn.
+    ///
+    /// \param position    Position of the tile in the grid, in tiles
+    /// \param textureRect Region of the texture to display in the tile
+    /// \param color       Color of the tile
+    ///
+    /// \see removeTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(const Vector2u& position, const IntRect& textureRect, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a tile, leaving its cell empty
+    ///
+    /// \param position Position of the tile in the grid, in tiles
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeTile(const Vector2u& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tiles in each direction
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in local units
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of tiles in each direction of a chunk
+    ///
+    /// \return Size of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// \return Local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// \return Global bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the map
+    ///
+    /// \return Bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<FloatRect> getCullingBounds() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Group of neighbouring tiles drawn together
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Vector2u                    size;         //!< Number of tiles in each direction
+        std::vector<Vertex>         vertices;     //!< Vertices of the tiles, 6 per tile
+        std::optional<VertexBuffer> buffer;       //!< Copy of the vertices on the graphics card, created on first draw
+        std::size_t                 dirtyBegin{}; //!< First vertex which has to be uploaded
+        std::size_t                 dirtyEnd{};   //!< One past the last vertex which has to be uploaded
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertices of a tile
+    ///
+    /// The vertices of the chunk containing the tile are allocated
+    /// if needed, and the tile is marked as needing an upload.
+    ///
+    /// \param position Position of the tile in the grid, in tiles
+    ///
+    /// \return Pointer to the 6 vertices of the tile
+    ///
+    ////////////////////////////////////////////////////////////
+    Vertex* getTileVertices(const Vector2u& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the modified vertices of a chunk to the graphics card
+    ///
+    /// The vertex buffer of the chunk is created the first time
+    /// that it is uploaded. If vertex buffers are not available,
+    /// this is remembered and all the chunks are drawn from
+    /// their client-side vertices from then on.
+    ///
+    /// \param chunk Chunk to update
+    ///
+    /// \return True if the chunk can be drawn from its vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool upload(Chunk& chunk) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                   m_mapSize;              //!< Number of tiles in each direction
+    Vector2f                   m_tileSize;             //!< Size of a tile, in local units
+    Vector2u                   m_chunkSize;            //!< Number of tiles in each direction of a chunk
+    Vector2u                   m_chunkCount;           //!< Number of chunks in each direction
+    const Texture*             m_texture{};            //!< Texture of the tiles
+    mutable std::vector<Chunk> m_chunks;               //!< Chunks of the map, row by row
+    mutable bool               m_buffersUnavailable{}; //!< Did creating a vertex buffer fail?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a large grid of equally-sized tiles, such
+/// as the ground of a scrolling 2D map, much faster than a single
+/// huge sf::VertexArray.
+///
+/// The map is split into chunks of neighbouring tiles, and each
+/// chunk keeps its vertices in a static sf::VertexBuffer. When the
+/// map is drawn, only the chunks intersecting the view of the
+/// render target are submitted, so the cost of drawing the map
+/// depends on the visible area rather than on the size of the map.
+/// Changing a tile only sends the vertices of that tile to the
+/// graphics card, with sf::VertexBuffer::update.
+///
+/// If vertex buffers are not available on the system, the visible
+/// chunks are drawn from their vertices in system memory instead.
+///
+/// Like other drawables, sf::TileMap inherits the functions of
+/// sf::Transformable: position, rotation, scale and origin.
+///
+/// Usage example:
+/// \code
+/// sf::TileMap map({1000, 1000}, {32.f, 32.f});
+/// map.setTexture(&tileset);
+///
+/// for (unsigned int y = 0; y < 1000; ++y)
+///     for (unsigned int x = 0; x < 1000; ++x)
+///         map.setTile({x, y}, sf::IntRect({32 * level[y][x], 0}, {32, 32}));
+///
+/// // Later, change a single tile
+/// map.setTile({10, 20}, sf::IntRect({0, 32}, {32, 32}));
+///
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include <SFML/Window/GlResource.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
@@ -321,6 +322,8 @@ public:
     static bool isAvailable();
 
 private:
+    friend class RenderTarget;
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex buffer to a render target
     ///
@@ -337,6 +340,7 @@ private:
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Stream};                        //!< How this vertex buffer is to be used
+    std::uint64_t m_cacheId{};                            //!< Unique number identifying the contents of the buffer
 };
 
 ////////////////////////////////////////////////////////////
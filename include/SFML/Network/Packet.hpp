@@ -409,6 +409,25 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void onReceive(const void* data, std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Called after the packet is received over the network,
+    ///        with the received bytes in a buffer that can be taken over
+    ///
+    /// Sockets call this function instead of onReceive when they
+    /// receive a packet in a buffer of their own, which derived
+    /// classes can reuse instead of copying the bytes. The default
+    /// implementation forwards the bytes to onReceive, so that
+    /// classes which only define onReceive keep working; when it
+    /// reaches the default onReceive, the buffer becomes the
+    /// packet's data without being copied.
+    ///
+    /// \param data Received bytes, which can be moved from
+    ///
+    /// \see onReceive
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onReceiveBuffer(std::vector<std::byte>&& data);
+
 private:
     ////////////////////////////////////////////////////////////
     /// Disallow comparisons between packets
@@ -432,10 +451,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_data;          //!< Data stored in the packet
-    std::size_t            m_readPos{};     //!< Current reading position in the packet
-    std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
-    bool                   m_isValid{true}; //!< Reading state of the packet
+    std::vector<std::byte>  m_data;             //!< Data stored in the packet
+    std::size_t             m_readPos{};        //!< Current reading position in the packet
+    std::size_t             m_sendPos{};        //!< Current send position in the packet (for handling partial sends)
+    bool                    m_isValid{true};    //!< Reading state of the packet
+    std::vector<std::byte>* m_receivedBuffer{}; //!< Buffer forwarded by onReceiveBuffer, which onReceive can take over
 };
 
 } // namespace sf
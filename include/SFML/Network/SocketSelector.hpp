@@ -33,18 +33,34 @@
 
 #include <memory>
 
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf
 {
 class Socket;
 
 ////////////////////////////////////////////////////////////
-/// \brief Multiplexer that allows to read from multiple sockets
+/// \brief Multiplexer that allows to read from and write to multiple sockets
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API SocketSelector
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Kinds of readiness that can be waited for
+    ///
+    /// The values are flags that can be combined.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Readiness
+    {
+        Receive = 1 << 0, //!< The socket can receive data (or accept a connection) without blocking
+        Send    = 1 << 1, //!< The socket can send data without blocking
+        Error   = 1 << 2  //!< An error or a disconnection is pending on the socket
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -95,12 +111,22 @@ public:
     /// while it is stored in the selector.
     /// This function does nothing if the socket is not valid.
     ///
-    /// \param socket Reference to the socket to add
+    /// By default the selector only waits for the socket to be
+    /// ready to receive. Watching for Send allows to resume a
+    /// partial send of a non-blocking socket as soon as it can
+    /// make progress; since a socket is almost always ready to
+    /// send, it should only be watched for Send while it has
+    /// pending data. Calling add again for a socket that is
+    /// already in the selector changes the readiness it is
+    /// watched for. Errors are always reported.
+    ///
+    /// \param socket    Reference to the socket to add
+    /// \param readiness Combination of Readiness flags to wait for
     ///
     /// \see remove, clear
     ///
     ////////////////////////////////////////////////////////////
-    void add(Socket& socket);
+    void add(Socket& socket, std::uint32_t readiness = Receive);
 
     ////////////////////////////////////////////////////////////
     /// \brief Remove a socket from the selector
@@ -128,11 +154,12 @@ public:
     void clear();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Wait until one or more sockets are ready to receive
+    /// \brief Wait until one or more sockets are ready
     ///
     /// This function returns as soon as at least one socket has
-    /// some data available to be received. To know which sockets are
-    /// ready, use the isReady function.
+    /// some data available to be received, or can send data if it
+    /// is watched for Send. To know which sockets are ready, use
+    /// the isReady function or getReadyCount and getReadySocket.
     /// If you use a timeout and no socket is ready before the timeout
     /// is over, the function returns false.
     ///
@@ -164,6 +191,77 @@ public:
     ////////////////////////////////////////////////////////////
     bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Test a socket to know if it has a given readiness
+    ///
+    /// This function must be used after a call to wait. When an
+    /// error is pending on a socket, it is also reported as ready
+    /// for the kinds it is watched for, since the next operation
+    /// will not block (it will fail instead).
+    ///
+    /// \param socket    Socket to test
+    /// \param readiness Combination of Readiness flags to test
+    ///
+    /// \return True if the socket has any of the given readiness flags, false otherwise
+    ///
+    /// \see getReadiness
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady(Socket& socket, std::uint32_t readiness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sockets that are ready
+    ///
+    /// This function must be used after a call to wait. Together
+    /// with getReadySocket, it allows to visit only the sockets
+    /// that are ready instead of testing every socket stored in
+    /// the selector with isReady.
+    ///
+    /// The count only changes with wait and clear: sockets
+    /// removed after wait keep their index, so that sockets can
+    /// be removed while the ready ones are visited.
+    ///
+    /// \return Number of sockets that were found ready by the last call to wait
+    ///
+    /// \see getReadySocket, wait
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReadyCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a socket that is ready
+    ///
+    /// The result is undefined if \a index is out of the range
+    /// [0, getReadyCount() - 1]. The returned sockets are those
+    /// that were passed to add, in no particular order.
+    ///
+    /// \param index Index of the ready socket to get
+    ///
+    /// \return Pointer to the index-th ready socket, or a null
+    ///         pointer if it was removed from the selector since
+    ///         the last call to wait
+    ///
+    /// \see getReadyCount, getReadiness, wait
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket* getReadySocket(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the readiness of a socket that is ready
+    ///
+    /// The result is undefined if \a index is out of the range
+    /// [0, getReadyCount() - 1].
+    ///
+    /// \param index Index of the ready socket, as passed to getReadySocket
+    ///
+    /// \return Combination of Readiness flags of the index-th ready socket,
+    ///         or 0 if it was removed from the selector since the last call to wait
+    ///
+    /// \see getReadyCount, getReadySocket, wait
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getReadiness(std::size_t index) const;
+
 private:
     struct SocketSelectorImpl;
 
@@ -203,7 +301,18 @@ private:
 /// Using a selector is simple:
 /// \li populate the selector with all the sockets that you want to observe
 /// \li make it wait until there is data available on any of the sockets
-/// \li test each socket to find out which ones are ready
+/// \li test each socket to find out which ones are ready, or visit
+///     only the ready ones with getReadyCount and getReadySocket
+///
+/// Sockets can also be watched for writability, which is useful
+/// to resume the partial sends of non-blocking sockets (see
+/// sf::Socket::Status::Partial) without polling them.
+///
+/// On Linux and Android the selector is built on epoll, so it can
+/// hold any number of sockets and its cost only depends on the
+/// number of sockets that are ready. On other systems it relies on
+/// select, which limits the sockets it can hold to FD_SETSIZE
+/// (usually 64 on Windows and 1024 elsewhere).
 ///
 /// Usage example:
 /// \code
@@ -266,6 +375,35 @@ private:
 /// }
 /// \endcode
 ///
+/// With many clients, testing every socket after each wakeup
+/// becomes expensive. The ready sockets can be visited directly
+/// instead:
+/// \code
+/// if (selector.wait())
+/// {
+///     for (std::size_t i = 0; i < selector.getReadyCount(); ++i)
+///     {
+///         // Sockets removed while visiting the list are skipped
+///         sf::Socket* socket = selector.getReadySocket(i);
+///         if (!socket)
+///             continue;
+///         ...
+///     }
+/// }
+/// \endcode
+///
+/// A non-blocking socket that couldn't send a whole packet can
+/// be watched for Send until the packet is gone:
+/// \code
+/// if (client.send(packet) == sf::Socket::Status::Partial)
+///     selector.add(client, sf::SocketSelector::Receive | sf::SocketSelector::Send);
+///
+/// ...
+///
+/// if (selector.isReady(client, sf::SocketSelector::Send) && (client.send(packet) == sf::Socket::Status::Done))
+///     selector.add(client, sf::SocketSelector::Receive);
+/// \endcode
+///
 /// \see sf::Socket
 ///
 ////////////////////////////////////////////////////////////
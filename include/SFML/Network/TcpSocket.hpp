@@ -126,6 +126,42 @@ public:
     ////////////////////////////////////////////////////////////
     void disconnect();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the buffering of received data
+    ///
+    /// When buffering is enabled, the socket receives data from
+    /// the system in large chunks and keeps the bytes that are
+    /// not requested yet for the next calls to receive. Several
+    /// small packets can then be extracted from a single system
+    /// call, which greatly reduces the cost of receiving many
+    /// small packets.
+    ///
+    /// Buffered bytes are not visible to the system anymore, so a
+    /// SocketSelector doesn't report the socket as ready while
+    /// packets are still waiting in it. When using a selector,
+    /// make the socket non-blocking and call receive until it
+    /// returns sf::Socket::Status::NotReady every time the socket
+    /// is ready.
+    ///
+    /// By default, received data is not buffered.
+    ///
+    /// \param buffered True to buffer received data, false to receive only what is requested
+    ///
+    /// \see isReceiveBuffered
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReceiveBuffered(bool buffered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the socket buffers received data
+    ///
+    /// \return True if received data is buffered, false otherwise
+    ///
+    /// \see setReceiveBuffered
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isReceiveBuffered() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Send raw data to the remote peer
     ///
@@ -165,6 +201,8 @@ public:
     ///
     /// In blocking mode, this function will wait until some
     /// bytes are actually received.
+    /// If received data is buffered, the bytes that are already
+    /// buffered are returned first, without waiting.
     /// This function will fail if the socket is not connected.
     ///
     /// \param data     Pointer to the array to fill with the received bytes
@@ -196,6 +234,30 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets of data to the remote peer
+    ///
+    /// The packets are sent in order, gathering as many of them
+    /// as possible into each system call. This is more efficient
+    /// than sending them one by one when many small packets are
+    /// sent to the same peer.
+    ///
+    /// In non-blocking mode, if this function returns sf::Socket::Status::Partial,
+    /// you \em must retry sending the same unmodified packets before sending
+    /// anything else. Packets that were already sent entirely are skipped
+    /// by the retry.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \param packets Pointer to the array of packets to send
+    /// \param count   Number of packets in the array
+    ///
+    /// \return Status code
+    ///
+    /// \see receive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(Packet* packets, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
@@ -226,11 +288,23 @@ private:
         std::vector<std::byte> Data;           //!< Data of the packet
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure holding the bytes received in advance
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ReceiveBuffer
+    {
+        std::vector<std::byte> Data;    //!< Storage of the received bytes
+        std::size_t            Begin{}; //!< Position of the first byte that wasn't consumed yet
+        std::size_t            End{};   //!< Position past the last received byte
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    PendingPacket m_pendingPacket;     //!< Temporary data of the packet currently being received
+    ReceiveBuffer m_receiveBuffer;     //!< Bytes received in advance, when buffering is enabled
+    bool          m_receiveBuffered{}; //!< Are received data buffered?
 };
 
 } // namespace sf
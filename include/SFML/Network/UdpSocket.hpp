@@ -55,6 +55,30 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Raw datagram sent or received as part of a batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        void*                    data{};        //!< Bytes to send (never written to), or buffer to fill when receiving
+        std::size_t              size{};        //!< Number of bytes to send, or size of the buffer when receiving
+        std::size_t              received{};    //!< Number of bytes received, filled when receiving
+        std::optional<IpAddress> remoteAddress; //!< Address of the receiver, or of the sender when receiving
+        unsigned short           remotePort{};  //!< Port of the receiver, or of the sender when receiving
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Formatted packet sent or received as part of a batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PacketDatagram
+    {
+        Packet*                  packet{};      //!< Packet to send, or to fill when receiving
+        std::optional<IpAddress> remoteAddress; //!< Address of the receiver, or of the sender when receiving
+        unsigned short           remotePort{};  //!< Port of the receiver, or of the sender when receiving
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,11 +218,110 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several raw datagrams to remote peers
+    ///
+    /// The datagrams are sent in order, with as few system calls
+    /// as possible. Each datagram must have a remote address and
+    /// must not be greater than UdpSocket::MaxDatagramSize,
+    /// otherwise this function fails before sending anything.
+    ///
+    /// In non-blocking mode, if this function returns
+    /// sf::Socket::Status::Partial, only the first \a sent
+    /// datagrams were sent; the remaining ones can be sent by
+    /// calling this function again with the rest of the array.
+    ///
+    /// \param datagrams Pointer to the array of datagrams to send
+    /// \param count     Number of datagrams in the array
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return Status code
+    ///
+    /// \see receive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const Datagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several raw datagrams from remote peers
+    ///
+    /// In blocking mode, this function waits until one datagram
+    /// is received; then it takes all the datagrams that are
+    /// already waiting, up to \a count, without blocking again.
+    /// The data, size and received members of the first
+    /// \a received datagrams are filled, as well as the address
+    /// and port of their sender. The same precautions about the
+    /// size of the buffers as for a single receive apply.
+    ///
+    /// Linux receives the whole batch in a single system call.
+    /// On Windows, a blocking socket only receives one datagram
+    /// per call, since the system can't be asked not to wait for
+    /// the next ones.
+    ///
+    /// \param datagrams Pointer to the array of datagrams to fill
+    /// \param count     Number of datagrams in the array
+    /// \param received  This variable is filled with the number of datagrams received
+    ///
+    /// \return Status code
+    ///
+    /// \see send
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(Datagram* datagrams, std::size_t count, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets of data to remote peers
+    ///
+    /// This function behaves like the raw version, each packet
+    /// being sent as a single datagram.
+    ///
+    /// \param datagrams Pointer to the array of packets to send, with their receiver
+    /// \param count     Number of packets in the array
+    /// \param sent      This variable is filled with the number of packets sent
+    ///
+    /// \return Status code
+    ///
+    /// \see receive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const PacketDatagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several formatted packets of data from remote peers
+    ///
+    /// This function behaves like the raw version. The first
+    /// \a received packets of the array are filled, as well as
+    /// the address and port of their sender.
+    ///
+    /// \param datagrams Pointer to the array of packets to fill
+    /// \param count     Number of packets in the array
+    /// \param received  This variable is filled with the number of packets received
+    ///
+    /// \return Status code
+    ///
+    /// \see send
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(PacketDatagram* datagrams, std::size_t count, std::size_t& received);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several raw datagrams from remote peers
+    ///
+    /// \param datagrams Pointer to the array of datagrams to fill
+    /// \param count     Number of datagrams in the array
+    /// \param received  This variable is filled with the number of datagrams received
+    /// \param wait      Whether a blocking socket may wait for the first datagram
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    Status receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received, bool wait);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet)
+    std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data of packets
 };
 
 } // namespace sf
@@ -31,10 +31,13 @@
 #include <SFML/Config.hpp>
 
 #include <SFML/System/Angle.hpp>
+#include <SFML/System/Archive.hpp>
+#include <SFML/System/ArchiveInputStream.hpp>
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Sleep.hpp>
 #include <SFML/System/String.hpp>
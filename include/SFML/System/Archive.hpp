@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#include <filesystem>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Read-only archive packing many files into a single one
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API Archive
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty archive, with no file open.
+    ///
+    ////////////////////////////////////////////////////////////
+    Archive();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Archive();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Archive(const Archive&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Archive& operator=(const Archive&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Archive(Archive&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Archive& operator=(Archive&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack all the files of a directory into an archive
+    ///
+    /// The directory is scanned recursively. Each file is stored
+    /// under its path relative to \a directory, with '/' as the
+    /// separator (for example "textures/hero.png").
+    ///
+    /// If \a compress is true, files are compressed with the
+    /// LZ4 block format when it makes them smaller. Files
+    /// that don't shrink, such as PNG images or Ogg files,
+    /// are stored as is and read without any decompression.
+    ///
+    /// \param filename  Path of the archive file to write
+    /// \param directory Directory containing the files to pack
+    /// \param compress  True to compress the files that benefit from it
+    ///
+    /// \return True if the archive was created successfully
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool create(const std::filesystem::path& filename,
+                                     const std::filesystem::path& directory,
+                                     bool                         compress = true);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an archive file
+    ///
+    /// The archive is mapped in memory and its index is loaded
+    /// in a hash table, so that entries can then be found in
+    /// constant time. No entry is read until it is opened
+    /// with an ArchiveInputStream.
+    ///
+    /// If another archive was open, it is closed first.
+    ///
+    /// \param filename Path of the archive file to open
+    ///
+    /// \return True if the archive was opened successfully
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the archive contains an entry
+    ///
+    /// \param name Path of the entry, relative to the packed directory
+    ///
+    /// \return True if the entry exists
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(const std::filesystem::path& name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries in the archive
+    ///
+    /// \return Number of entries
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEntryCount() const;
+
+private:
+    friend class ArchiveInputStream;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry of the archive
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::string_view name;         //!< Path of the entry, pointing into the mapped archive
+        const std::byte* data{};       //!< Stored data of the entry, in the mapped archive
+        std::uint64_t    storedSize{}; //!< Size of the stored data, in bytes
+        std::uint64_t    size{};       //!< Size of the entry once decompressed, in bytes
+        bool             compressed{}; //!< Is the data compressed?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find an entry of the archive
+    ///
+    /// \param name Path of the entry
+    ///
+    /// \return Pointer to the entry, or null if it doesn't exist
+    ///
+    ////////////////////////////////////////////////////////////
+    const Entry* findEntry(const std::filesystem::path& name) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream                          m_file;    //!< Mapped archive file
+    std::vector<Entry>                             m_entries; //!< Entries of the archive
+    std::unordered_map<std::uint64_t, std::size_t> m_index;   //!< Index of the entries, by hash of their path
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Archive
+/// \ingroup system
+///
+/// sf::Archive packs a whole directory of resources into a
+/// single file, so that loading thousands of small files
+/// doesn't cost thousands of file system lookups and opens.
+///
+/// Archives are created once, usually as a build step, with
+/// the create function. At run time, the archive file is
+/// opened and mapped in memory, and its entries are read with
+/// sf::ArchiveInputStream, which can be passed to all the
+/// loadFromStream functions of SFML resource classes.
+///
+/// The archive is never modified once open: any number of
+/// threads can open and read entries concurrently, as long
+/// as each thread uses its own ArchiveInputStream. The
+/// archive must stay alive while its streams are used.
+///
+/// Usage example:
+/// \code
+/// // At build time
+/// if (!sf::Archive::create("assets.pak", "assets"))
+///     return -1;
+///
+/// // At run time
+/// sf::Archive archive;
+/// if (!archive.open("assets.pak"))
+///     return -1;
+///
+/// sf::ArchiveInputStream stream;
+/// sf::Texture texture;
+/// if (!stream.open(archive, "textures/hero.png") || !texture.loadFromStream(stream))
+///     return -1;
+/// \endcode
+///
+/// \see sf::ArchiveInputStream
+///
+////////////////////////////////////////////////////////////
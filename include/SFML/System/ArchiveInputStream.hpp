@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Archive;
+
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on an entry of an archive
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ArchiveInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ArchiveInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ArchiveInputStream(const ArchiveInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ArchiveInputStream& operator=(const ArchiveInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ArchiveInputStream(ArchiveInputStream&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ArchiveInputStream& operator=(ArchiveInputStream&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from an entry of an archive
+    ///
+    /// Stored entries are read straight from the mapped archive.
+    /// Compressed entries are decompressed once, in a buffer
+    /// owned by the stream.
+    ///
+    /// The archive must stay alive while the stream is used.
+    ///
+    /// \param archive Open archive containing the entry
+    /// \param name    Path of the entry, relative to the packed directory
+    ///
+    /// \return True on success, false on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const Archive& archive, const std::filesystem::path& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t read(void* data, std::int64_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t seek(std::int64_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or -1 on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::int64_t getSize() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte*       m_data{};   //!< Pointer to the data of the entry
+    std::int64_t           m_size{};   //!< Size of the entry
+    std::int64_t           m_offset{}; //!< Current reading position
+    std::vector<std::byte> m_buffer;   //!< Decompressed data, for compressed entries
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ArchiveInputStream
+/// \ingroup system
+///
+/// This class is a specialization of InputStream that
+/// reads an entry of an sf::Archive.
+///
+/// Like the other input streams, it can be passed to the
+/// loadFromStream and openFromStream functions of SFML
+/// resource classes. Each stream has its own reading
+/// position: several threads can read entries of the same
+/// archive at the same time, each with its own stream.
+///
+/// Usage example:
+/// \code
+/// sf::Archive archive;
+/// if (!archive.open("assets.pak"))
+///     return -1;
+///
+/// sf::ArchiveInputStream stream;
+/// sf::Font font;
+/// if (!stream.open(archive, "fonts/title.ttf") || !font.loadFromStream(stream))
+///     return -1;
+/// \endcode
+///
+/// Note that some resources keep reading their stream after
+/// they are loaded (sf::Font, sf::Music): the stream must
+/// then stay alive as long as the resource.
+///
+/// \see sf::Archive, InputStream
+///
+////////////////////////////////////////////////////////////
@@ -257,6 +257,17 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window's contents are displayed
+    ///
+    /// This function is called by display() so that derived
+    /// classes can finish their pending rendering before the
+    /// backbuffer is presented on screen.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Processes an event before it is sent to the user
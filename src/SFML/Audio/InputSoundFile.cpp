@@ -30,8 +30,8 @@
 #include <SFML/Audio/SoundFileReader.hpp>
 
 #include <SFML/System/Err.hpp>
-#include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Time.hpp>
 
@@ -77,8 +77,8 @@ bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
     if (!reader)
         return false;
 
-    // Wrap the file into a stream
-    auto file = std::make_unique<FileInputStream>();
+    // Wrap the file into a stream, mapped in memory so that decoders read it without going through stdio buffers
+    auto file = std::make_unique<MappedFileInputStream>();
 
     // Open it
     if (!file->open(filename))
@@ -35,7 +35,7 @@
 #include <SFML/Audio/SoundFileWriterWav.hpp>
 
 #include <SFML/System/Err.hpp>
-#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 
@@ -75,7 +75,7 @@ std::unique_ptr<SoundFileReader> SoundFileFactory::createReaderFromFilename(cons
     ensureDefaultReadersWritersRegistered();
 
     // Wrap the input file into a file stream
-    FileInputStream stream;
+    MappedFileInputStream stream;
     if (!stream.open(filename))
     {
         err() << "Failed to open sound file (couldn't open stream)\n" << formatDebugPathInfo(filename) << std::endl;
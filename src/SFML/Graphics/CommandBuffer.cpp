@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandBuffer.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CommandBuffer::CommandBuffer(const Vector2u& size) : m_size(size)
+{
+    // Setup the default view from the size
+    RenderTarget::initialize();
+
+    // The view active when the commands are replayed is not known yet
+    setCullingEnabled(false);
+}
+
+
+////////////////////////////////////////////////////////////
+CommandBuffer::~CommandBuffer() = default;
+
+
+////////////////////////////////////////////////////////////
+CommandBuffer::CommandBuffer(CommandBuffer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+CommandBuffer& CommandBuffer::operator=(CommandBuffer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Vector2u CommandBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::setActive(bool /* active */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::reset()
+{
+    m_commands.clear();
+    m_vertices.clear();
+    m_instances.clear();
+    m_views.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandBuffer::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::record(const Vertex*       vertices,
+                           std::size_t         vertexCount,
+                           PrimitiveType       type,
+                           const RenderStates& states)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type          = CommandType::DrawVertices;
+    command.states        = states;
+    command.primitiveType = type;
+    command.index         = m_vertices.size();
+    command.count         = vertexCount;
+
+    m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::record(const VertexBuffer& vertexBuffer,
+                           std::size_t         firstVertex,
+                           std::size_t         vertexCount,
+                           const RenderStates& states)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type         = CommandType::DrawVertexBuffer;
+    command.states       = states;
+    command.index        = firstVertex;
+    command.count        = vertexCount;
+    command.vertexBuffer = &vertexBuffer;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::record(const VertexBuffer& vertexBuffer,
+                           const IndexBuffer&  indexBuffer,
+                           std::size_t         firstIndex,
+                           std::size_t         indexCount,
+                           const RenderStates& states)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type         = CommandType::DrawIndexedBuffer;
+    command.states       = states;
+    command.index        = firstIndex;
+    command.count        = indexCount;
+    command.vertexBuffer = &vertexBuffer;
+    command.indexBuffer  = &indexBuffer;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::record(const VertexBuffer& vertexBuffer,
+                           const Instance*     instances,
+                           std::size_t         instanceCount,
+                           const RenderStates& states)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type         = CommandType::DrawInstances;
+    command.states       = states;
+    command.index        = m_instances.size();
+    command.count        = instanceCount;
+    command.vertexBuffer = &vertexBuffer;
+
+    m_instances.insert(m_instances.end(), instances, instances + instanceCount);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandBuffer::record(const Color& color)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type  = CommandType::Clear;
+    command.color = color;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::record(const View& view)
+{
+    Command& command = m_commands.emplace_back();
+
+    command.type  = CommandType::SetView;
+    command.index = m_views.size();
+
+    m_views.push_back(view);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandBuffer::replay(RenderTarget& target, std::size_t first, std::size_t count) const
+{
+    assert(first + count <= m_commands.size() && "CommandBuffer::replay() Range is out of bounds");
+
+    for (std::size_t i = first; i < first + count; ++i)
+    {
+        const Command& command = m_commands[i];
+        switch (command.type)
+        {
+            case CommandType::DrawVertices:
+                target.draw(&m_vertices[command.index], command.count, command.primitiveType, command.states);
+                break;
+            case CommandType::DrawVertexBuffer:
+                target.draw(*command.vertexBuffer, command.index, command.count, command.states);
+                break;
+            case CommandType::DrawIndexedBuffer:
+                target.draw(*command.vertexBuffer, *command.indexBuffer, command.index, command.count, command.states);
+                break;
+            case CommandType::DrawInstances:
+                target.drawInstanced(*command.vertexBuffer, &m_instances[command.index], command.count, command.states);
+                break;
+            case CommandType::Clear:
+                target.clear(command.color);
+                break;
+            case CommandType::SetView:
+                target.setView(m_views[command.index]);
+                break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderStates& CommandBuffer::getCommandStates(std::size_t index) const
+{
+    assert(index < m_commands.size() && "CommandBuffer::getCommandStates() Index is out of bounds");
+    return m_commands[index].states;
+}
+
+} // namespace sf
@@ -0,0 +1,903 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressedImageImpl
+{
+using Block = std::array<std::array<std::uint8_t, 4>, 16>;
+
+// Read little endian integers from a file in memory
+std::uint32_t readUint32(const std::uint8_t* data)
+{
+    return std::uint32_t{data[0]} | (std::uint32_t{data[1]} << 8) | (std::uint32_t{data[2]} << 16) |
+           (std::uint32_t{data[3]} << 24);
+}
+
+std::uint64_t readUint64(const std::uint8_t* data)
+{
+    return std::uint64_t{readUint32(data)} | (std::uint64_t{readUint32(data + 4)} << 32);
+}
+
+constexpr std::uint32_t makeFourCC(const char (&code)[5])
+{
+    return static_cast<std::uint32_t>(code[0]) | (static_cast<std::uint32_t>(code[1]) << 8) |
+           (static_cast<std::uint32_t>(code[2]) << 16) | (static_cast<std::uint32_t>(code[3]) << 24);
+}
+
+std::uint64_t getBlockSize(sf::priv::CompressedFormat format)
+{
+    return format == sf::priv::CompressedFormat::Bc1 ? 8 : 16;
+}
+
+// Computed in 64 bits, so that the number of blocks can't wrap around for sizes read from a file
+std::uint64_t getBlockCount(const sf::Vector2u& size)
+{
+    return ((std::uint64_t{size.x} + 3) / 4) * ((std::uint64_t{size.y} + 3) / 4);
+}
+
+// Check the size read from a file before anything is computed from it
+bool checkSize(const sf::Vector2u& size)
+{
+    const unsigned int maximumSize = sf::Texture::getMaximumSize();
+
+    if ((size.x == 0) || (size.y == 0) || (size.x > maximumSize) || (size.y > maximumSize))
+    {
+        sf::err() << "Failed to load compressed image, invalid size (" << size.x << "x" << size.y
+                  << "), maximum is " << maximumSize << "x" << maximumSize << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// DDS
+////////////////////////////////////////////////////////////
+bool parseDds(const std::uint8_t* data, std::size_t dataSize, sf::priv::CompressedImage& image)
+{
+    constexpr std::size_t headerSize   = 128; // Magic number followed by DDS_HEADER
+    constexpr std::size_t dx10Size     = 20;  // Size of DDS_HEADER_DXT10
+    constexpr std::uint32_t fourCCFlag = 0x4; // DDPF_FOURCC
+
+    if ((dataSize < headerSize) || (readUint32(data + 4) != 124))
+    {
+        sf::err() << "Failed to load compressed image, invalid DDS header" << std::endl;
+        return false;
+    }
+
+    image.size = {readUint32(data + 16), readUint32(data + 12)};
+
+    if (!checkSize(image.size))
+        return false;
+
+    const std::uint32_t fourCC = readUint32(data + 84);
+    std::size_t         offset = headerSize;
+
+    if (!(readUint32(data + 80) & fourCCFlag))
+    {
+        sf::err() << "Failed to load compressed image, DDS file is not block compressed" << std::endl;
+        return false;
+    }
+
+    if (fourCC == makeFourCC("DXT1"))
+    {
+        image.format = sf::priv::CompressedFormat::Bc1;
+    }
+    else if (fourCC == makeFourCC("DXT5"))
+    {
+        image.format = sf::priv::CompressedFormat::Bc3;
+    }
+    else if (fourCC == makeFourCC("DX10") && (dataSize >= headerSize + dx10Size))
+    {
+        // The extended header gives the format as a DXGI_FORMAT value
+        switch (readUint32(data + headerSize))
+        {
+            case 71: // DXGI_FORMAT_BC1_UNORM
+            case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+                image.format = sf::priv::CompressedFormat::Bc1;
+                break;
+            case 77: // DXGI_FORMAT_BC3_UNORM
+            case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+                image.format = sf::priv::CompressedFormat::Bc3;
+                break;
+            case 98: // DXGI_FORMAT_BC7_UNORM
+            case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+                image.format = sf::priv::CompressedFormat::Bc7;
+                break;
+            default:
+                sf::err() << "Failed to load compressed image, unsupported DDS format "
+                          << readUint32(data + headerSize) << std::endl;
+                return false;
+        }
+
+        // Only plain 2D textures are supported
+        if ((readUint32(data + headerSize + 4) != 3) || (readUint32(data + headerSize + 12) > 1))
+        {
+            sf::err() << "Failed to load compressed image, DDS file is not a 2D texture" << std::endl;
+            return false;
+        }
+
+        offset += dx10Size;
+    }
+    else
+    {
+        sf::err() << "Failed to load compressed image, unsupported DDS format" << std::endl;
+        return false;
+    }
+
+    // The top mipmap level comes first
+    const std::uint64_t blocksSize = getBlockCount(image.size) * getBlockSize(image.format);
+
+    if (blocksSize > dataSize - offset)
+    {
+        sf::err() << "Failed to load compressed image, DDS file is truncated" << std::endl;
+        return false;
+    }
+
+    image.blocks     = data + offset;
+    image.blocksSize = static_cast<std::size_t>(blocksSize);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// KTX2
+////////////////////////////////////////////////////////////
+constexpr std::array<std::uint8_t, 12> ktx2Identifier =
+    {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+bool parseKtx2(const std::uint8_t* data, std::size_t dataSize, sf::priv::CompressedImage& image)
+{
+    constexpr std::size_t headerSize = 80; // Identifier, header and index
+    constexpr std::size_t levelSize  = 24; // Size of a level index entry
+
+    if (dataSize < headerSize + levelSize)
+    {
+        sf::err() << "Failed to load compressed image, invalid KTX2 header" << std::endl;
+        return false;
+    }
+
+    switch (readUint32(data + 12))
+    {
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            image.format = sf::priv::CompressedFormat::Bc1;
+            break;
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+            image.format = sf::priv::CompressedFormat::Bc3;
+            break;
+        case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+        case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+            image.format = sf::priv::CompressedFormat::Bc7;
+            break;
+        case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+            image.format = sf::priv::CompressedFormat::Etc2;
+            break;
+        default:
+            sf::err() << "Failed to load compressed image, unsupported KTX2 format " << readUint32(data + 12)
+                      << std::endl;
+            return false;
+    }
+
+    image.size = {readUint32(data + 20), readUint32(data + 24)};
+
+    if (!checkSize(image.size))
+        return false;
+
+    // Only plain 2D textures are supported
+    if ((readUint32(data + 28) > 1) || (readUint32(data + 32) > 1) || (readUint32(data + 36) != 1))
+    {
+        sf::err() << "Failed to load compressed image, KTX2 file is not a 2D texture" << std::endl;
+        return false;
+    }
+
+    if (readUint32(data + 44) != 0)
+    {
+        sf::err() << "Failed to load compressed image, supercompressed KTX2 files are not supported" << std::endl;
+        return false;
+    }
+
+    // The level index starts with the top mipmap level
+    const std::uint64_t offset = readUint64(data + headerSize);
+    const std::uint64_t length = readUint64(data + headerSize + 8);
+
+    const std::uint64_t blocksSize = getBlockCount(image.size) * getBlockSize(image.format);
+
+    if ((offset > dataSize) || (length > dataSize - offset) || (length < blocksSize))
+    {
+        sf::err() << "Failed to load compressed image, KTX2 file is truncated" << std::endl;
+        return false;
+    }
+
+    image.blocks     = data + offset;
+    image.blocksSize = static_cast<std::size_t>(blocksSize);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// BC1 / BC3
+////////////////////////////////////////////////////////////
+std::array<std::uint8_t, 4> unpackRgb565(std::uint16_t color)
+{
+    const auto r = static_cast<std::uint8_t>((color >> 11) & 0x1F);
+    const auto g = static_cast<std::uint8_t>((color >> 5) & 0x3F);
+    const auto b = static_cast<std::uint8_t>(color & 0x1F);
+
+    return {static_cast<std::uint8_t>((r << 3) | (r >> 2)),
+            static_cast<std::uint8_t>((g << 2) | (g >> 4)),
+            static_cast<std::uint8_t>((b << 3) | (b >> 2)),
+            255};
+}
+
+void decodeBc1Colors(const std::uint8_t* data, bool allowTransparency, Block& block)
+{
+    const auto color0 = static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+    const auto color1 = static_cast<std::uint16_t>(data[2] | (data[3] << 8));
+
+    std::array<std::array<std::uint8_t, 4>, 4> palette{unpackRgb565(color0), unpackRgb565(color1)};
+
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+        const int c0 = palette[0][c];
+        const int c1 = palette[1][c];
+
+        if ((color0 > color1) || !allowTransparency)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2 * c0 + c1) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((c0 + 2 * c1) / 3);
+        }
+        else
+        {
+            palette[2][c] = static_cast<std::uint8_t>((c0 + c1) / 2);
+            palette[3][c] = 0;
+        }
+    }
+
+    palette[2][3] = 255;
+    palette[3][3] = ((color0 > color1) || !allowTransparency) ? 255 : 0;
+
+    const std::uint32_t indices = readUint32(data + 4);
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i] = palette[(indices >> (2 * i)) & 0x3];
+}
+
+void decodeBc3Alpha(const std::uint8_t* data, Block& block)
+{
+    const int alpha0 = data[0];
+    const int alpha1 = data[1];
+
+    std::array<std::uint8_t, 8> palette{static_cast<std::uint8_t>(alpha0), static_cast<std::uint8_t>(alpha1)};
+
+    if (alpha0 > alpha1)
+    {
+        for (int i = 1; i < 7; ++i)
+            palette[static_cast<std::size_t>(i + 1)] = static_cast<std::uint8_t>(((7 - i) * alpha0 + i * alpha1) / 7);
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+            palette[static_cast<std::size_t>(i + 1)] = static_cast<std::uint8_t>(((5 - i) * alpha0 + i * alpha1) / 5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    std::uint64_t indices = 0;
+    for (std::size_t i = 0; i < 6; ++i)
+        indices |= std::uint64_t{data[2 + i]} << (8 * i);
+
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i][3] = palette[(indices >> (3 * i)) & 0x7];
+}
+
+////////////////////////////////////////////////////////////
+// BC7
+////////////////////////////////////////////////////////////
+struct Bc7Mode
+{
+    unsigned int subsets;
+    unsigned int partitionBits;
+    unsigned int rotationBits;
+    unsigned int indexSelectionBits;
+    unsigned int colorBits;
+    unsigned int alphaBits;
+    unsigned int endpointPBits;
+    unsigned int sharedPBits;
+    unsigned int indexBits;
+    unsigned int secondaryIndexBits;
+};
+
+constexpr std::array<Bc7Mode, 8> bc7Modes = {{{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+                                              {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+                                              {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+                                              {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+                                              {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+                                              {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+                                              {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+                                              {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}}};
+
+// Subset of each pixel for the 2-subset partitions, one bit per pixel
+constexpr std::array<std::uint16_t, 64> bc7Partitions2 =
+    {0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8,
+     0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110,
+     0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C, 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696,
+     0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660, 0x0272, 0x04E4, 0x4E40, 0x2720,
+     0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22};
+
+// Subset of each pixel for the 3-subset partitions, two bits per pixel
+constexpr std::array<std::uint32_t, 64> bc7Partitions3 =
+    {0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+     0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+     0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+     0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+     0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+     0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+     0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+     0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254};
+
+// Pixel whose index has an implicit most significant bit, for the second and third subsets
+constexpr std::array<std::uint8_t, 64> bc7Anchors2 = {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+                                                      15, 15, 15, 15, 2,  8,  2,  2,  8,  8,  15, 2,  8,
+                                                      2,  2,  8,  8,  2,  2,  15, 15, 6,  8,  2,  8,  15,
+                                                      15, 2,  8,  2,  2,  2,  15, 15, 6,  6,  2,  6,  8,
+                                                      15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15};
+
+constexpr std::array<std::uint8_t, 64> bc7Anchors3a = {3,  3,  15, 15, 8,  3,  15, 15, 8,  8,  6,  6,  6,
+                                                       5,  3,  3,  3,  3,  8,  15, 3,  3,  6,  10, 5,  8,
+                                                       8,  6,  8,  5,  15, 15, 8,  15, 3,  5,  6,  10, 8,
+                                                       15, 15, 3,  15, 5,  15, 15, 15, 15, 3,  15, 5,  5,
+                                                       5,  8,  5,  10, 5,  10, 8,  13, 15, 12, 3,  3};
+
+constexpr std::array<std::uint8_t, 64> bc7Anchors3b = {15, 8,  8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15,
+                                                       15, 15, 8,  15, 8,  15, 3,  15, 8,  15, 8,  3,  15,
+                                                       6,  10, 15, 15, 10, 8,  15, 3,  15, 10, 10, 8,  9,
+                                                       10, 6,  15, 8,  15, 3,  6,  6,  8,  15, 3,  15, 15,
+                                                       15, 15, 15, 15, 15, 15, 15, 15, 3,  15, 15, 8};
+
+constexpr std::array<std::uint8_t, 4>  bc7Weights2 = {0, 21, 43, 64};
+constexpr std::array<std::uint8_t, 8>  bc7Weights3 = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr std::array<std::uint8_t, 16> bc7Weights4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Read the bits of a block one field after the other, least significant bit first
+class BitReader
+{
+public:
+    explicit BitReader(const std::uint8_t* data) : m_data(data)
+    {
+    }
+
+    unsigned int read(unsigned int count)
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; i < count; ++i, ++m_position)
+            value |= ((m_data[m_position / 8] >> (m_position % 8)) & 1u) << i;
+
+        return value;
+    }
+
+private:
+    const std::uint8_t* m_data;
+    std::size_t         m_position{};
+};
+
+std::uint8_t bc7Interpolate(unsigned int e0, unsigned int e1, unsigned int index, unsigned int indexBits)
+{
+    const unsigned int weight = indexBits == 2   ? bc7Weights2[index]
+                                : indexBits == 3 ? bc7Weights3[index]
+                                                 : bc7Weights4[index];
+
+    return static_cast<std::uint8_t>(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+}
+
+void decodeBc7(const std::uint8_t* data, Block& block)
+{
+    // The mode is given by the position of the lowest set bit
+    unsigned int mode = 0;
+    while ((mode < 8) && !(data[0] & (1u << mode)))
+        ++mode;
+
+    if (mode == 8)
+    {
+        // Reserved mode, decoded as transparent black
+        block = {};
+        return;
+    }
+
+    const Bc7Mode& info = bc7Modes[mode];
+    BitReader      reader(data);
+    reader.read(mode + 1);
+
+    const unsigned int partition      = reader.read(info.partitionBits);
+    const unsigned int rotation       = reader.read(info.rotationBits);
+    const unsigned int indexSelection = reader.read(info.indexSelectionBits);
+
+    // Endpoints are stored channel by channel, then come their P-bits
+    const unsigned int                         endpointCount = info.subsets * 2;
+    std::array<std::array<unsigned int, 4>, 6> endpoints{};
+    for (std::size_t c = 0; c < 3; ++c)
+        for (unsigned int e = 0; e < endpointCount; ++e)
+            endpoints[e][c] = reader.read(info.colorBits);
+
+    for (unsigned int e = 0; e < endpointCount; ++e)
+        endpoints[e][3] = reader.read(info.alphaBits);
+
+    unsigned int colorBits = info.colorBits;
+    unsigned int alphaBits = info.alphaBits;
+
+    if (info.endpointPBits || info.sharedPBits)
+    {
+        std::array<unsigned int, 6> pBits{};
+        if (info.endpointPBits)
+        {
+            for (unsigned int e = 0; e < endpointCount; ++e)
+                pBits[e] = reader.read(1);
+        }
+        else
+        {
+            for (unsigned int s = 0; s < info.subsets; ++s)
+                pBits[s * 2] = pBits[s * 2 + 1] = reader.read(1);
+        }
+
+        for (unsigned int e = 0; e < endpointCount; ++e)
+            for (unsigned int& channel : endpoints[e])
+                channel = (channel << 1) | pBits[e];
+
+        ++colorBits;
+        if (alphaBits)
+            ++alphaBits;
+    }
+
+    // Expand the endpoints to 8 bits by replicating their most significant bits
+    for (unsigned int e = 0; e < endpointCount; ++e)
+    {
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            const unsigned int bits = c < 3 ? colorBits : alphaBits;
+            unsigned int&      v    = endpoints[e][c];
+            v                       = bits ? ((v << (8 - bits)) | (v >> (2 * bits - 8))) & 0xFF : 255;
+        }
+    }
+
+    // Find the subset of each pixel, and whether it is an anchor whose index is one bit shorter
+    std::array<unsigned int, 16> subsets{};
+    std::array<bool, 16>         anchors{};
+    anchors[0] = true;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        if (info.subsets == 2)
+            subsets[i] = (bc7Partitions2[partition] >> i) & 0x1;
+        else if (info.subsets == 3)
+            subsets[i] = (bc7Partitions3[partition] >> (2 * i)) & 0x3;
+    }
+
+    if (info.subsets == 2)
+    {
+        anchors[bc7Anchors2[partition]] = true;
+    }
+    else if (info.subsets == 3)
+    {
+        anchors[bc7Anchors3a[partition]] = true;
+        anchors[bc7Anchors3b[partition]] = true;
+    }
+
+    std::array<unsigned int, 16> indices{};
+    for (std::size_t i = 0; i < 16; ++i)
+        indices[i] = reader.read(info.indexBits - (anchors[i] ? 1 : 0));
+
+    // Modes 4 and 5 have a second set of indices, whose only anchor is the first pixel
+    std::array<unsigned int, 16> secondaryIndices{};
+    if (info.secondaryIndexBits)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+            secondaryIndices[i] = reader.read(info.secondaryIndexBits - (i == 0 ? 1 : 0));
+    }
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        const std::array<unsigned int, 4>& e0 = endpoints[subsets[i] * 2];
+        const std::array<unsigned int, 4>& e1 = endpoints[subsets[i] * 2 + 1];
+
+        unsigned int colorIndex = indices[i];
+        unsigned int colorBits2 = info.indexBits;
+        unsigned int alphaIndex = indices[i];
+        unsigned int alphaBits2 = info.indexBits;
+
+        if (info.secondaryIndexBits)
+        {
+            alphaIndex = secondaryIndices[i];
+            alphaBits2 = info.secondaryIndexBits;
+
+            if (indexSelection)
+            {
+                std::swap(colorIndex, alphaIndex);
+                std::swap(colorBits2, alphaBits2);
+            }
+        }
+
+        for (std::size_t c = 0; c < 3; ++c)
+            block[i][c] = bc7Interpolate(e0[c], e1[c], colorIndex, colorBits2);
+        block[i][3] = bc7Interpolate(e0[3], e1[3], alphaIndex, alphaBits2);
+
+        // Undo the swap of the alpha channel with one of the color channels
+        if (rotation)
+            std::swap(block[i][3], block[i][rotation - 1]);
+    }
+}
+
+////////////////////////////////////////////////////////////
+// ETC2 / EAC
+////////////////////////////////////////////////////////////
+std::uint64_t readBigEndian64(const std::uint8_t* data)
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+        value = (value << 8) | data[i];
+
+    return value;
+}
+
+std::uint8_t clampColor(int value)
+{
+    return static_cast<std::uint8_t>(std::clamp(value, 0, 255));
+}
+
+constexpr std::array<std::array<int, 2>, 8> etcModifiers =
+    {{{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}}};
+
+constexpr std::array<int, 8> etcDistances = {3, 6, 11, 16, 23, 32, 41, 64};
+
+constexpr std::array<std::array<int, 8>, 16> eacModifiers = {{{-3, -6, -9, -15, 2, 5, 8, 14},
+                                                              {-3, -7, -10, -13, 2, 6, 9, 12},
+                                                              {-2, -5, -8, -13, 1, 4, 7, 12},
+                                                              {-2, -4, -6, -13, 1, 3, 5, 12},
+                                                              {-3, -6, -8, -12, 2, 5, 7, 11},
+                                                              {-3, -7, -9, -11, 2, 6, 8, 10},
+                                                              {-4, -7, -8, -11, 3, 6, 7, 10},
+                                                              {-3, -5, -8, -11, 2, 4, 7, 10},
+                                                              {-2, -6, -8, -10, 1, 5, 7, 9},
+                                                              {-2, -5, -8, -10, 1, 4, 7, 9},
+                                                              {-2, -4, -8, -10, 1, 3, 7, 9},
+                                                              {-2, -5, -7, -10, 1, 4, 6, 9},
+                                                              {-3, -4, -7, -10, 2, 3, 6, 9},
+                                                              {-1, -2, -3, -10, 0, 1, 2, 9},
+                                                              {-4, -6, -8, -9, 3, 5, 7, 8},
+                                                              {-3, -5, -7, -9, 2, 4, 6, 8}}};
+
+// ETC pixels are stored column by column, while blocks are stored row by row
+std::size_t etcPixel(std::size_t i)
+{
+    return (i % 4) * 4 + i / 4;
+}
+
+void decodeEacAlpha(const std::uint8_t* data, Block& block)
+{
+    const std::uint64_t bits       = readBigEndian64(data);
+    const int           base       = data[0];
+    const int           multiplier = data[1] >> 4;
+    const auto&         modifiers  = eacModifiers[data[1] & 0xF];
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        const auto index      = static_cast<std::size_t>((bits >> (45 - 3 * i)) & 0x7);
+        block[etcPixel(i)][3] = clampColor(base + modifiers[index] * multiplier);
+    }
+}
+
+void decodeEtc2Colors(const std::uint8_t* data, Block& block)
+{
+    const std::uint64_t bits = readBigEndian64(data);
+
+    const auto field = [bits](unsigned int position, unsigned int count)
+    { return static_cast<int>((bits >> position) & ((1u << count) - 1)); };
+
+    const auto extend4 = [](int value) { return (value << 4) | value; };
+    const auto extend5 = [](int value) { return (value << 3) | (value >> 2); };
+    const auto extend6 = [](int value) { return (value << 2) | (value >> 4); };
+    const auto extend7 = [](int value) { return (value << 1) | (value >> 6); };
+
+    // Two bits per pixel, split between the most and least significant halves
+    const auto pixelIndex = [bits](std::size_t i)
+    { return static_cast<std::size_t>((((bits >> (16 + i)) & 1) << 1) | ((bits >> i) & 1)); };
+
+    const auto setColor = [&block](std::size_t i, int r, int g, int b)
+    {
+        std::array<std::uint8_t, 4>& pixel = block[etcPixel(i)];
+        pixel[0]                           = clampColor(r);
+        pixel[1]                           = clampColor(g);
+        pixel[2]                           = clampColor(b);
+    };
+
+    const bool differential = field(33, 1);
+
+    // In differential mode, an overflowing second base color selects one of the ETC2 modes
+    const auto signExtend3 = [](int value) { return value >= 4 ? value - 8 : value; };
+    const int  r           = field(59, 5);
+    const int  g           = field(51, 5);
+    const int  b           = field(43, 5);
+    const int  r2          = r + signExtend3(field(56, 3));
+    const int  g2          = g + signExtend3(field(48, 3));
+    const int  b2          = b + signExtend3(field(40, 3));
+
+    if (differential && (r2 < 0 || r2 > 31))
+    {
+        // T mode
+        const std::array<int, 3> c1 = {extend4((field(59, 2) << 2) | field(56, 2)),
+                                       extend4(field(52, 4)),
+                                       extend4(field(48, 4))};
+        const std::array<int, 3> c2 = {extend4(field(44, 4)), extend4(field(40, 4)), extend4(field(36, 4))};
+        const int                d  = etcDistances[static_cast<std::size_t>((field(34, 2) << 1) | field(32, 1))];
+
+        const std::array<std::array<int, 3>, 4> paint = {
+            {c1, {c2[0] + d, c2[1] + d, c2[2] + d}, c2, {c2[0] - d, c2[1] - d, c2[2] - d}}};
+
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            const auto& color = paint[pixelIndex(i)];
+            setColor(i, color[0], color[1], color[2]);
+        }
+    }
+    else if (differential && (g2 < 0 || g2 > 31))
+    {
+        // H mode
+        const std::array<int, 3> c1 = {field(59, 4),
+                                       (field(56, 3) << 1) | field(52, 1),
+                                       (field(51, 1) << 3) | field(47, 3)};
+        const std::array<int, 3> c2 = {field(43, 4), field(39, 4), field(35, 4)};
+
+        // The order of the two base colors gives the last bit of the distance
+        const int ordering = ((c1[0] << 8) | (c1[1] << 4) | c1[2]) >= ((c2[0] << 8) | (c2[1] << 4) | c2[2]);
+        const int d = etcDistances[static_cast<std::size_t>((field(34, 1) << 2) | (field(32, 1) << 1) | ordering)];
+
+        std::array<std::array<int, 3>, 4> paint{};
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            paint[0][c] = extend4(c1[c]) + d;
+            paint[1][c] = extend4(c1[c]) - d;
+            paint[2][c] = extend4(c2[c]) + d;
+            paint[3][c] = extend4(c2[c]) - d;
+        }
+
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            const auto& color = paint[pixelIndex(i)];
+            setColor(i, color[0], color[1], color[2]);
+        }
+    }
+    else if (differential && (b2 < 0 || b2 > 31))
+    {
+        // Planar mode: the colors are interpolated from the origin, horizontal and vertical colors
+        const std::array<int, 3> o = {extend6(field(57, 6)),
+                                      extend7((field(56, 1) << 6) | field(49, 6)),
+                                      extend6((field(48, 1) << 5) | (field(43, 2) << 3) | field(39, 3))};
+        const std::array<int, 3> h = {extend6((field(34, 5) << 1) | field(32, 1)),
+                                      extend7(field(25, 7)),
+                                      extend6(field(19, 6))};
+        const std::array<int, 3> v = {extend6(field(13, 6)), extend7(field(6, 7)), extend6(field(0, 6))};
+
+        for (std::size_t y = 0; y < 4; ++y)
+        {
+            for (std::size_t x = 0; x < 4; ++x)
+            {
+                std::array<std::uint8_t, 4>& pixel = block[y * 4 + x];
+                for (std::size_t c = 0; c < 3; ++c)
+                {
+                    const int value = (static_cast<int>(x) * (h[c] - o[c]) + static_cast<int>(y) * (v[c] - o[c]) +
+                                       4 * o[c] + 2) >>
+                                      2;
+                    pixel[c] = clampColor(value);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Individual or differential mode: two sub-blocks, each with its own base color and modifier table
+        std::array<std::array<int, 3>, 2> bases{};
+        if (differential)
+        {
+            bases[0] = {extend5(r), extend5(g), extend5(b)};
+            bases[1] = {extend5(r2), extend5(g2), extend5(b2)};
+        }
+        else
+        {
+            bases[0] = {extend4(field(60, 4)), extend4(field(52, 4)), extend4(field(44, 4))};
+            bases[1] = {extend4(field(56, 4)), extend4(field(48, 4)), extend4(field(40, 4))};
+        }
+
+        const std::array<std::size_t, 2> tables = {static_cast<std::size_t>(field(37, 3)),
+                                                   static_cast<std::size_t>(field(34, 3))};
+        const bool                       flip   = field(32, 1);
+
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            // Pixel i is at column i / 4 and row i % 4
+            const std::size_t subBlock = flip ? ((i % 4) >= 2) : ((i / 4) >= 2);
+            const auto&       modifier = etcModifiers[tables[subBlock]];
+            const std::size_t index    = pixelIndex(i);
+            const int         delta    = (index & 1 ? modifier[1] : modifier[0]) * (index & 2 ? -1 : 1);
+            const auto&       base     = bases[subBlock];
+            setColor(i, base[0] + delta, base[1] + delta, base[2] + delta);
+        }
+    }
+}
+} // namespace CompressedImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool parseCompressedImage(const std::uint8_t* data, std::size_t dataSize, CompressedImage& image)
+{
+    using namespace CompressedImageImpl;
+
+    bool parsed = false;
+    if ((dataSize >= 4) && (readUint32(data) == makeFourCC("DDS ")))
+    {
+        parsed = parseDds(data, dataSize, image);
+    }
+    else if ((dataSize >= ktx2Identifier.size()) && std::equal(ktx2Identifier.begin(), ktx2Identifier.end(), data))
+    {
+        parsed = parseKtx2(data, dataSize, image);
+    }
+    else
+    {
+        err() << "Failed to load compressed image, unknown file format (only DDS and KTX2 are supported)" << std::endl;
+    }
+
+    return parsed;
+}
+
+
+////////////////////////////////////////////////////////////
+bool isCompressedFormatSupported(CompressedFormat format)
+{
+    static const std::array<bool, 4> supported = []
+    {
+        // Make sure that extensions are initialized
+        ensureExtensionsInit();
+
+        std::array<bool, 4> result{};
+        if (!GLEXT_texture_compression)
+            return result;
+
+        // Formats listed here can be used with glCompressedTexImage2D, even without advertising an extension
+        GLint formatCount = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount));
+        std::vector<GLint> formats(static_cast<std::size_t>(std::max(formatCount, 0)));
+        if (!formats.empty())
+            glCheck(glGetIntegerv(GLEXT_GL_COMPRESSED_TEXTURE_FORMATS, formats.data()));
+
+        const auto isListed = [&formats](GLenum internalFormat)
+        { return std::find(formats.begin(), formats.end(), static_cast<GLint>(internalFormat)) != formats.end(); };
+
+        const bool s3tc = Context::isExtensionAvailable("GL_EXT_texture_compression_s3tc");
+
+        result[static_cast<std::size_t>(CompressedFormat::Bc1)] = s3tc || isListed(GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1);
+        result[static_cast<std::size_t>(CompressedFormat::Bc3)] = s3tc || isListed(GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5);
+        result[static_cast<std::size_t>(CompressedFormat::Bc7)] = GLEXT_texture_compression_bptc ||
+                                                                  Context::isExtensionAvailable(
+                                                                      "GL_ARB_texture_compression_bptc") ||
+                                                                  Context::isExtensionAvailable(
+                                                                      "GL_EXT_texture_compression_bptc") ||
+                                                                  isListed(GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM);
+        result[static_cast<std::size_t>(CompressedFormat::Etc2)] = GLEXT_texture_compression_etc2 ||
+                                                                   isListed(GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC);
+
+        return result;
+    }();
+
+    return supported[static_cast<std::size_t>(format)];
+}
+
+
+////////////////////////////////////////////////////////////
+GLenum getCompressedInternalFormat(CompressedFormat format, bool sRgb)
+{
+    switch (format)
+    {
+        case CompressedFormat::Bc1:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1;
+        case CompressedFormat::Bc3:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5;
+        case CompressedFormat::Bc7:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case CompressedFormat::Etc2:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC;
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void decompressImage(const CompressedImage& image, std::vector<std::uint8_t>& pixels)
+{
+    using namespace CompressedImageImpl;
+
+    pixels.resize(std::size_t{image.size.x} * image.size.y * 4);
+
+    const auto          blockSize = static_cast<std::size_t>(getBlockSize(image.format));
+    const std::uint8_t* data      = image.blocks;
+    Block               block{};
+
+    for (unsigned int blockY = 0; blockY < image.size.y; blockY += 4)
+    {
+        for (unsigned int blockX = 0; blockX < image.size.x; blockX += 4, data += blockSize)
+        {
+            switch (image.format)
+            {
+                case CompressedFormat::Bc1:
+                    decodeBc1Colors(data, true, block);
+                    break;
+                case CompressedFormat::Bc3:
+                    decodeBc1Colors(data + 8, false, block);
+                    decodeBc3Alpha(data, block);
+                    break;
+                case CompressedFormat::Bc7:
+                    decodeBc7(data, block);
+                    break;
+                case CompressedFormat::Etc2:
+                    decodeEtc2Colors(data + 8, block);
+                    decodeEacAlpha(data, block);
+                    break;
+            }
+
+            // Copy the pixels of the block, blocks on the right and bottom edges may be partially outside of the image
+            const unsigned int width  = std::min(4u, image.size.x - blockX);
+            const unsigned int height = std::min(4u, image.size.y - blockY);
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                std::uint8_t* row = pixels.data() + (std::size_t{blockY + y} * image.size.x + blockX) * 4;
+                std::memcpy(row, block[y * 4].data(), std::size_t{width} * 4);
+            }
+        }
+    }
+}
+
+} // namespace sf::priv
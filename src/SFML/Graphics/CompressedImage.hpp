@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Block compression formats of compressed images
+///
+////////////////////////////////////////////////////////////
+enum class CompressedFormat
+{
+    Bc1, //!< BC1 / DXT1, 8 bytes per 4x4 block, 1-bit alpha
+    Bc3, //!< BC3 / DXT5, 16 bytes per 4x4 block
+    Bc7, //!< BC7 / BPTC, 16 bytes per 4x4 block
+    Etc2 //!< ETC2 RGBA8 with EAC alpha, 16 bytes per 4x4 block
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Top level of a block compressed image
+///
+/// The blocks are not copied, they point into the memory
+/// the image was parsed from.
+///
+////////////////////////////////////////////////////////////
+struct CompressedImage
+{
+    CompressedFormat    format{};     //!< Block compression format
+    Vector2u            size;         //!< Size of the image, in pixels
+    const std::uint8_t* blocks{};     //!< Compressed blocks, row by row from the top left corner
+    std::size_t         blocksSize{}; //!< Size of the compressed blocks, in bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Parse a DDS or KTX2 file in memory
+///
+/// Only the top mipmap level of 2D images is used. Images
+/// with a zero size, or larger than Texture::getMaximumSize(),
+/// are rejected.
+///
+/// \param data     Pointer to the file data in memory
+/// \param dataSize Size of the data, in bytes
+/// \param image    Image to fill
+///
+/// \return True if the file was parsed successfully
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool parseCompressedImage(const std::uint8_t* data, std::size_t dataSize, CompressedImage& image);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the graphics card can store a compressed format as is
+///
+/// This function must be called with a context active.
+///
+/// \param format Block compression format
+///
+/// \return True if images in this format can be uploaded without decompressing them
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompressedFormatSupported(CompressedFormat format);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the OpenGL internal format of a compressed format
+///
+/// \param format Block compression format
+/// \param sRgb   True to get the sRGB variant of the format
+///
+/// \return OpenGL internal format to pass to glCompressedTexImage2D
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum getCompressedInternalFormat(CompressedFormat format, bool sRgb);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress an image to 32-bits RGBA pixels
+///
+/// \param image  Compressed image
+/// \param pixels Array of pixels to fill with the decompressed image
+///
+////////////////////////////////////////////////////////////
+void decompressImage(const CompressedImage& image, std::vector<std::uint8_t>& pixels);
+
+} // namespace sf::priv
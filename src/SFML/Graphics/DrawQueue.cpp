@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/DrawQueue.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace DrawQueueImpl
+{
+// Order render states so that identical states end up next to each other.
+// Shaders are the most expensive to switch, then textures, then blend modes.
+bool isLess(const sf::RenderStates& left, const sf::RenderStates& right)
+{
+    if (left.shader != right.shader)
+        return std::less<>()(left.shader, right.shader);
+
+    if (left.texture != right.texture)
+        return std::less<>()(left.texture, right.texture);
+
+    const auto tie = [](const sf::BlendMode& mode)
+    {
+        return std::tie(mode.colorSrcFactor,
+                        mode.colorDstFactor,
+                        mode.colorEquation,
+                        mode.alphaSrcFactor,
+                        mode.alphaDstFactor,
+                        mode.alphaEquation);
+    };
+
+    return tie(left.blendMode) < tie(right.blendMode);
+}
+} // namespace DrawQueueImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+DrawQueue::DrawQueue() : m_commands({1, 1})
+{
+    // The target isn't known before the queue is drawn, and the recorded primitives don't depend on its size
+}
+
+
+////////////////////////////////////////////////////////////
+DrawQueue::~DrawQueue() = default;
+
+
+////////////////////////////////////////////////////////////
+DrawQueue::DrawQueue(DrawQueue&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+DrawQueue& DrawQueue::operator=(DrawQueue&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::submit(const Drawable& drawable, int layer, float depth, const RenderStates& states)
+{
+    const std::size_t firstCommand = m_commands.getCommandCount();
+    m_commands.draw(drawable, states);
+    const std::size_t commandCount = m_commands.getCommandCount() - firstCommand;
+
+    // Nothing was recorded?
+    if (commandCount == 0)
+        return;
+
+    // Keep the items sorted as long as they come in order
+    const Item item{layer, depth, firstCommand, commandCount};
+    if (m_sorted && !m_items.empty() && isLess(item, m_items.back()))
+        m_sorted = false;
+
+    m_items.push_back(item);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::draw(RenderTarget& target)
+{
+    if (!m_sorted)
+    {
+        std::stable_sort(m_items.begin(),
+                         m_items.end(),
+                         [this](const Item& left, const Item& right) { return isLess(left, right); });
+        m_sorted = true;
+    }
+
+    for (const Item& item : m_items)
+        m_commands.replay(target, item.firstCommand, item.commandCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::clear()
+{
+    m_commands.reset();
+    m_items.clear();
+    m_sorted = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t DrawQueue::getSize() const
+{
+    return m_items.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool DrawQueue::isLess(const Item& left, const Item& right) const
+{
+    if (left.layer != right.layer)
+        return left.layer < right.layer;
+
+    // Group the items by the render states of their first command
+    const RenderStates& leftStates  = m_commands.getCommandStates(left.firstCommand);
+    const RenderStates& rightStates = m_commands.getCommandStates(right.firstCommand);
+    if (DrawQueueImpl::isLess(leftStates, rightStates))
+        return true;
+
+    if (DrawQueueImpl::isLess(rightStates, leftStates))
+        return false;
+
+    return left.depth < right.depth;
+}
+
+} // namespace sf
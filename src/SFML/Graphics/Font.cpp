@@ -28,11 +28,13 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
 #endif
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -41,6 +43,12 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <ostream>
 #include <type_traits>
 
@@ -86,6 +94,154 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
     return (static_cast<std::uint64_t>(reinterpret<std::uint32_t>(outlineThickness)) << 32) |
            (static_cast<std::uint64_t>(bold) << 31) | index;
 }
+
+// Lock the mutex of font handles, if any, until the returned lock is destroyed
+template <typename T>
+std::unique_lock<std::recursive_mutex> lockFontHandles(const std::shared_ptr<T>& fontHandles)
+{
+    return fontHandles ? std::unique_lock(fontHandles->mutex) : std::unique_lock<std::recursive_mutex>();
+}
+
+// Leave a small padding around characters, so that filtering doesn't
+// pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Make sure that the given size is the current one of a face
+bool setFaceSize(FT_Face face, unsigned int characterSize)
+{
+    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
+    // only when necessary to avoid killing performances
+
+    const FT_UShort currentSize = face->size->metrics.x_ppem;
+
+    if (currentSize != characterSize)
+    {
+        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+
+        if (result == FT_Err_Invalid_Pixel_Size)
+        {
+            // In the case of bitmap fonts, resizing can
+            // fail if the requested size is not available
+            if (!FT_IS_SCALABLE(face))
+            {
+                sf::err() << "Failed to set bitmap font size to " << characterSize << std::endl;
+                sf::err() << "Available sizes are: ";
+                for (int i = 0; i < face->num_fixed_sizes; ++i)
+                {
+                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
+                    sf::err() << size << " ";
+                }
+                sf::err() << std::endl;
+            }
+            else
+            {
+                sf::err() << "Failed to set font size to " << characterSize << std::endl;
+            }
+        }
+
+        return result == FT_Err_Ok;
+    }
+
+    return true;
+}
+
+// Value standing for an infinite distance in distance transforms
+constexpr float distanceInfinity = 1e20f;
+
+// Replace every value of a grid by the squared euclidean distance to the nearest zero value,
+// using the separable linear time algorithm of Felzenszwalb and Huttenlocher; the grid
+// must only contain zeros and distanceInfinity
+void squaredDistanceTransform(std::vector<float>& grid, std::size_t width, std::size_t height)
+{
+    const std::size_t        size = std::max(width, height);
+    std::vector<float>       input(size);
+    std::vector<float>       output(size);
+    std::vector<float>       boundaries(size + 1);
+    std::vector<std::size_t> parabolas(size);
+
+    // Compute the lower envelope of the parabolas rooted at each input value
+    const auto transform = [&](std::size_t count)
+    {
+        const auto intersection = [&](std::size_t q, std::size_t p)
+        {
+            const auto qf = static_cast<float>(q);
+            const auto pf = static_cast<float>(p);
+            return ((input[q] + qf * qf) - (input[p] + pf * pf)) / (2.f * qf - 2.f * pf);
+        };
+
+        std::size_t k = 0;
+        parabolas[0]  = 0;
+        boundaries[0] = -std::numeric_limits<float>::infinity();
+        boundaries[1] = std::numeric_limits<float>::infinity();
+
+        for (std::size_t q = 1; q < count; ++q)
+        {
+            float s = intersection(q, parabolas[k]);
+            while (s <= boundaries[k])
+                s = intersection(q, parabolas[--k]);
+
+            ++k;
+            parabolas[k]      = q;
+            boundaries[k]     = s;
+            boundaries[k + 1] = std::numeric_limits<float>::infinity();
+        }
+
+        k = 0;
+        for (std::size_t q = 0; q < count; ++q)
+        {
+            while (boundaries[k + 1] < static_cast<float>(q))
+                ++k;
+
+            const float offset = static_cast<float>(q) - static_cast<float>(parabolas[k]);
+            output[q]          = offset * offset + input[parabolas[k]];
+        }
+    };
+
+    // Transform the columns, then the rows
+    for (std::size_t x = 0; x < width; ++x)
+    {
+        for (std::size_t y = 0; y < height; ++y)
+            input[y] = grid[x + y * width];
+        transform(height);
+        for (std::size_t y = 0; y < height; ++y)
+            grid[x + y * width] = output[y];
+    }
+
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        const auto row = grid.begin() + static_cast<std::ptrdiff_t>(y * width);
+        std::copy_n(row, width, input.begin());
+        transform(width);
+        std::copy_n(output.begin(), width, row);
+    }
+}
+
+// Fragment shader turning distance field glyphs into antialiased shapes,
+// the edge being at the distance given by the threshold uniform
+constexpr const char* distanceFieldShaderSource = R"(
+uniform sampler2D texture;
+uniform float threshold;
+
+void main()
+{
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+    float width    = max(fwidth(distance) * 0.5, 0.0001);
+    float alpha    = smoothstep(threshold - width, threshold + width, distance);
+    gl_FragColor   = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FontImpl
+{
+// Thread-safe generator of the numbers identifying a set of loaded glyphs
+std::uint64_t getUniqueGeneration() noexcept
+{
+    static std::atomic<std::uint64_t> generation(1);
+
+    return generation.fetch_add(1);
+}
+} // namespace FontImpl
 } // namespace
 
 
@@ -120,11 +276,28 @@ struct Font::FontHandles
     FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
     FT_Face      face{};      //< Pointer to the internal font face
     FT_Stroker   stroker{};   //< Pointer to the stroker
+
+#ifndef SFML_SYSTEM_ANDROID
+    MappedFileInputStream file; //< Mapping of the font file read by the face, released after it
+#endif
+
+    std::recursive_mutex mutex; //< Mutex protecting the handles from concurrent accesses by prewarm threads
 };
 
 
 ////////////////////////////////////////////////////////////
-Font::Font() = default;
+struct Font::DistanceFieldShaders
+{
+    Shader                         fill;     //< Shader drawing the glyphs' fill, at their own edge
+    std::map<std::uint8_t, Shader> outlines; //< Shaders drawing the glyphs' outline, by edge threshold in 1/255 units
+    bool                           loaded{}; //< Was the fill shader successfully compiled?
+};
+
+
+////////////////////////////////////////////////////////////
+Font::Font() : m_generation(FontImpl::getUniqueGeneration())
+{
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -134,7 +307,11 @@ m_fontHandles(copy.m_fontHandles),
 m_isSmooth(copy.m_isSmooth),
 m_info(copy.m_info),
 m_pages(copy.m_pages),
-m_pixelBuffer(copy.m_pixelBuffer)
+m_pixelBuffer(copy.m_pixelBuffer),
+m_distanceField(copy.m_distanceField),
+m_distanceFieldPage(copy.m_distanceFieldPage),
+m_distanceFieldShaders(copy.m_distanceFieldShaders),
+m_generation(copy.m_generation)
 {
 }
 
@@ -170,9 +347,20 @@ bool Font::loadFromFile(const std::filesystem::path& filename)
         return false;
     }
 
-    // Load the new font face from the specified file
+    // Map the file in memory, FreeType then reads it in place instead of through stdio buffers
+    if (!fontHandles->file.open(filename))
+    {
+        err() << "Failed to load font (failed to open the file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Load the new font face from the mapped file
     FT_Face face;
-    if (FT_New_Face(fontHandles->library, filename.string().c_str(), 0, &face) != 0)
+    if (FT_New_Memory_Face(fontHandles->library,
+                           static_cast<const FT_Byte*>(fontHandles->file.getData()),
+                           static_cast<FT_Long>(fontHandles->file.getSize()),
+                           0,
+                           &face) != 0)
     {
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
         return false;
@@ -349,29 +537,47 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
     // Get the page corresponding to the character size
     GlyphTable& glyphs = loadPage(characterSize).glyphs;
 
+    // Latin-1 glyphs without outline are looked up directly by code point, once loaded
+    const bool latin1 = (codePoint < GlyphTable::Latin1Size) && (outlineThickness == 0);
+    if (latin1)
+    {
+        if (const Glyph* glyph = glyphs.findLatin1(codePoint, bold))
+            return *glyph;
+    }
+
+    // Prevent prewarm threads from using the face meanwhile
+    const auto lock = lockFontHandles(m_fontHandles);
+
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     const std::uint64_t key = combine(outlineThickness,
                                       bold,
                                       FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
 
     // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
-    {
-        // Found: just return it
-        return it->second;
-    }
-    else
+    const Glyph* glyph = glyphs.find(key);
+
+    // Not found: it may have been prewarmed
+    if (!glyph && !m_prewarmTasks.empty())
     {
-        // Not found: we have to load it
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return glyphs.emplace(key, glyph).first->second;
+        updatePrewarmedGlyphs(false);
+        glyph = glyphs.find(key);
     }
+
+    // Otherwise we have to load it
+    if (!glyph)
+        glyph = &glyphs.insert(key, loadGlyph(codePoint, characterSize, bold, outlineThickness));
+
+    if (latin1)
+        glyphs.mapLatin1(codePoint, bold, key);
+
+    return *glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(std::uint32_t codePoint) const
 {
+    const auto lock = lockFontHandles(m_fontHandles);
     return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
 }
 
@@ -383,7 +589,8 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
     if (first == 0 || second == 0)
         return 0.f;
 
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    const auto lock = lockFontHandles(m_fontHandles);
+    FT_Face    face = m_fontHandles ? m_fontHandles->face : nullptr;
 
     if (face && setCurrentSize(characterSize))
     {
@@ -392,8 +599,14 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
         const FT_UInt index2 = FT_Get_Char_Index(face, second);
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+        // (distance field glyphs have the same ones, use them to avoid rasterizing a whole page)
+        const bool distanceField = m_distanceField && (characterSize == DistanceFieldCharacterSize);
+        const auto getDeltaGlyph = [&](std::uint32_t codePoint) -> const Glyph&
+        {
+            return distanceField ? getDistanceFieldGlyph(codePoint, bold) : getGlyph(codePoint, characterSize, bold);
+        };
+        const auto firstRsbDelta  = static_cast<float>(getDeltaGlyph(first).rsbDelta);
+        const auto secondLsbDelta = static_cast<float>(getDeltaGlyph(second).lsbDelta);
 
         // Get the kerning vector if present
         FT_Vector kerning;
@@ -421,7 +634,8 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 ////////////////////////////////////////////////////////////
 float Font::getLineSpacing(unsigned int characterSize) const
 {
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    const auto lock = lockFontHandles(m_fontHandles);
+    FT_Face    face = m_fontHandles ? m_fontHandles->face : nullptr;
 
     if (face && setCurrentSize(characterSize))
     {
@@ -437,7 +651,8 @@ float Font::getLineSpacing(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 float Font::getUnderlinePosition(unsigned int characterSize) const
 {
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    const auto lock = lockFontHandles(m_fontHandles);
+    FT_Face    face = m_fontHandles ? m_fontHandles->face : nullptr;
 
     if (face && setCurrentSize(characterSize))
     {
@@ -458,7 +673,8 @@ float Font::getUnderlinePosition(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 float Font::getUnderlineThickness(unsigned int characterSize) const
 {
-    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    const auto lock = lockFontHandles(m_fontHandles);
+    FT_Face    face = m_fontHandles ? m_fontHandles->face : nullptr;
 
     if (face && setCurrentSize(characterSize))
     {
@@ -479,9 +695,101 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 const Texture& Font::getTexture(unsigned int characterSize) const
 {
+    // Add the prewarmed glyphs which are ready, so that texts notice the texture change
+    if (!m_prewarmTasks.empty())
+        updatePrewarmedGlyphs(false);
+
     return loadPage(characterSize).texture;
 }
 
+
+////////////////////////////////////////////////////////////
+void Font::prewarm(const String&                     characters,
+                   const std::vector<unsigned int>& characterSizes,
+                   bool                             bold,
+                   float                            outlineThickness) const
+{
+    if (!m_fontHandles || !m_fontHandles->face)
+        return;
+
+    // Select the glyphs which are not loaded yet
+    std::vector<std::pair<unsigned int, std::uint32_t>> requests;
+    {
+        const auto lock = lockFontHandles(m_fontHandles);
+
+        for (const unsigned int characterSize : characterSizes)
+        {
+            const auto page = m_pages.find(characterSize);
+
+            for (const std::uint32_t codePoint : characters)
+            {
+                const std::uint64_t key = combine(outlineThickness,
+                                                  bold,
+                                                  FT_Get_Char_Index(m_fontHandles->face, codePoint));
+
+                if ((page == m_pages.end()) || !page->second.glyphs.find(key))
+                    requests.emplace_back(characterSize, codePoint);
+            }
+        }
+    }
+
+    // Rasterize each glyph once, grouped by character size
+    std::sort(requests.begin(), requests.end());
+    requests.erase(std::unique(requests.begin(), requests.end()), requests.end());
+
+    if (requests.empty())
+        return;
+
+    // Rasterize them in a background thread, locking the face for one glyph at a time
+    // so that the glyphs requested meanwhile by the rendering thread don't wait too long
+    PrewarmTask task;
+    task.cancelled = std::make_shared<std::atomic<bool>>(false);
+
+    auto rasterize = [fontHandles = m_fontHandles,
+                      cancelled   = task.cancelled,
+                      requests    = std::move(requests),
+                      bold,
+                      outlineThickness]
+    {
+        std::vector<RasterizedGlyph> glyphs;
+        glyphs.reserve(requests.size());
+
+        for (const auto& [characterSize, codePoint] : requests)
+        {
+            if (*cancelled)
+                break;
+
+            const std::lock_guard lock(fontHandles->mutex);
+
+            RasterizedGlyph& glyph = glyphs.emplace_back();
+            glyph.characterSize    = characterSize;
+            glyph.key   = combine(outlineThickness, bold, FT_Get_Char_Index(fontHandles->face, codePoint));
+            glyph.glyph = rasterizeGlyph(*fontHandles, codePoint, characterSize, bold, outlineThickness, glyph.pixels);
+        }
+
+        return glyphs;
+    };
+
+    task.glyphs = std::async(std::launch::async, std::move(rasterize));
+    m_prewarmTasks.push_back(std::move(task));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isPrewarming() const
+{
+    updatePrewarmedGlyphs(false);
+
+    return !m_prewarmTasks.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::waitForPrewarm() const
+{
+    updatePrewarmedGlyphs(true);
+}
+
 ////////////////////////////////////////////////////////////
 void Font::setSmooth(bool smooth)
 {
@@ -503,6 +811,63 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+    if (enabled != m_distanceField)
+    {
+        m_distanceField = enabled;
+
+        // Texts switch to the other set of glyphs
+        m_generation = FontImpl::getUniqueGeneration();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_distanceField;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const
+{
+    GlyphTable& glyphs = loadDistanceFieldPage().glyphs;
+
+    // Latin-1 glyphs are looked up directly by code point, once loaded
+    const bool latin1 = codePoint < GlyphTable::Latin1Size;
+    if (latin1)
+    {
+        if (const Glyph* glyph = glyphs.findLatin1(codePoint, bold))
+            return *glyph;
+    }
+
+    const auto lock = lockFontHandles(m_fontHandles);
+
+    const std::uint64_t key = combine(0.f,
+                                      bold,
+                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+
+    const Glyph* glyph = glyphs.find(key);
+    if (!glyph)
+        glyph = &glyphs.insert(key, loadDistanceFieldGlyph(codePoint, bold));
+
+    if (latin1)
+        glyphs.mapLatin1(codePoint, bold, key);
+
+    return *glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& Font::getDistanceFieldTexture() const
+{
+    return loadDistanceFieldPage().texture;
+}
+
+
 ////////////////////////////////////////////////////////////
 Font& Font::operator=(const Font& right)
 {
@@ -513,6 +878,11 @@ Font& Font::operator=(const Font& right)
     std::swap(m_info, temp.m_info);
     std::swap(m_pages, temp.m_pages);
     std::swap(m_pixelBuffer, temp.m_pixelBuffer);
+    std::swap(m_distanceField, temp.m_distanceField);
+    std::swap(m_distanceFieldPage, temp.m_distanceFieldPage);
+    std::swap(m_distanceFieldShaders, temp.m_distanceFieldShaders);
+    std::swap(m_generation, temp.m_generation);
+    std::swap(m_prewarmTasks, temp.m_prewarmTasks);
 
 #ifdef SFML_SYSTEM_ANDROID
     std::swap(m_stream, temp.m_stream);
@@ -525,12 +895,19 @@ Font& Font::operator=(const Font& right)
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
+    // Stop rasterizing glyphs of the previous font
+    m_prewarmTasks.clear();
+
     // Drop ownership of shared FreeType pointers
     m_fontHandles.reset();
 
     // Reset members
     m_pages.clear();
+    m_distanceFieldPage.reset();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
+
+    // Glyphs previously returned by the font are no longer valid
+    m_generation = FontImpl::getUniqueGeneration();
 }
 
 
@@ -544,20 +921,60 @@ Font::Page& Font::loadPage(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
-    // The glyph to return
-    Glyph glyph;
-
     // Stop if no font is loaded
     if (!m_fontHandles)
-        return glyph;
+        return {};
+
+    // Rasterize the glyph
+    Glyph glyph = rasterizeGlyph(*m_fontHandles, codePoint, characterSize, bold, outlineThickness, m_pixelBuffer);
+
+    if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+    {
+        const unsigned int width  = static_cast<unsigned int>(glyph.textureRect.width) + 2 * glyphPadding;
+        const unsigned int height = static_cast<unsigned int>(glyph.textureRect.height) + 2 * glyphPadding;
+
+        // Get the glyphs page corresponding to the character size
+        Page& page = loadPage(characterSize);
+
+        // Find a good position for the new glyph into the texture
+        glyph.textureRect = findGlyphRect(page, {width, height});
+
+        // Make sure the texture data is positioned in the center
+        // of the allocated texture rectangle
+        glyph.textureRect.left += static_cast<int>(glyphPadding);
+        glyph.textureRect.top += static_cast<int>(glyphPadding);
+        glyph.textureRect.width -= static_cast<int>(2 * glyphPadding);
+        glyph.textureRect.height -= static_cast<int>(2 * glyphPadding);
+
+        // Write the pixels to the texture
+        const unsigned int x = static_cast<unsigned int>(glyph.textureRect.left) - glyphPadding;
+        const unsigned int y = static_cast<unsigned int>(glyph.textureRect.top) - glyphPadding;
+        page.texture.update(m_pixelBuffer.data(), {width, height}, {x, y});
+    }
+
+    // Done :)
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::rasterizeGlyph(FontHandles&               fontHandles,
+                           std::uint32_t              codePoint,
+                           unsigned int               characterSize,
+                           bool                       bold,
+                           float                      outlineThickness,
+                           std::vector<std::uint8_t>& pixelBuffer)
+{
+    // The glyph to return
+    Glyph glyph;
 
     // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
+    FT_Face face = fontHandles.face;
     if (!face)
         return glyph;
 
     // Set the character size
-    if (!setCurrentSize(characterSize))
+    if (!setFaceSize(face, characterSize))
         return glyph;
 
     // Load the glyph corresponding to the code point
@@ -585,7 +1002,7 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
 
         if (outlineThickness != 0)
         {
-            FT_Stroker stroker = m_fontHandles->stroker;
+            FT_Stroker stroker = fontHandles.stroker;
 
             FT_Stroker_Set(stroker,
                            static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)),
@@ -607,7 +1024,7 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
     if (!outline)
     {
         if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+            FT_Bitmap_Embolden(fontHandles.library, &bitmap, weight, weight);
 
         if (outlineThickness != 0)
             err() << "Failed to outline glyph (no fallback available)" << std::endl;
@@ -626,25 +1043,14 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
 
     if ((width > 0) && (height > 0))
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        const unsigned int padding = glyphPadding;
 
         width += 2 * padding;
         height += 2 * padding;
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
-
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, {width, height});
-
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.left += static_cast<int>(padding);
-        glyph.textureRect.top += static_cast<int>(padding);
-        glyph.textureRect.width -= static_cast<int>(2 * padding);
-        glyph.textureRect.height -= static_cast<int>(2 * padding);
+        // The texture rectangle only holds the size of the glyph until it is stored in a page
+        glyph.textureRect.width  = static_cast<int>(bitmap.width);
+        glyph.textureRect.height = static_cast<int>(bitmap.rows);
 
         // Compute the glyph's bounding box
         glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
@@ -653,9 +1059,9 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
         glyph.bounds.height = static_cast<float>(bitmap.rows);
 
         // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+        pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
 
-        std::uint8_t* current = m_pixelBuffer.data();
+        std::uint8_t* current = pixelBuffer.data();
         std::uint8_t* end     = current + width * height * 4;
 
         while (current != end)
@@ -677,7 +1083,7 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
                 {
                     // The color channels remain white, just fill the alpha channel
                     const std::size_t index = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
                 }
                 pixels += bitmap.pitch;
             }
@@ -690,37 +1096,318 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
                 for (unsigned int x = padding; x < width - padding; ++x)
                 {
                     // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                    const std::size_t index    = x + y * width;
+                    pixelBuffer[index * 4 + 3] = pixels[x - padding];
                 }
                 pixels += bitmap.pitch;
             }
         }
-
-        // Write the pixels to the texture
-        const unsigned int x = static_cast<unsigned int>(glyph.textureRect.left) - padding;
-        const unsigned int y = static_cast<unsigned int>(glyph.textureRect.top) - padding;
-        const unsigned int w = static_cast<unsigned int>(glyph.textureRect.width) + 2 * padding;
-        const unsigned int h = static_cast<unsigned int>(glyph.textureRect.height) + 2 * padding;
-        page.texture.update(m_pixelBuffer.data(), {w, h}, {x, y});
     }
 
     // Delete the FT glyph
     FT_Done_Glyph(glyphDesc);
 
-    // Done :)
     return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
+void Font::updatePrewarmedGlyphs(bool wait) const
+{
+    for (auto task = m_prewarmTasks.begin(); task != m_prewarmTasks.end();)
+    {
+        if (!wait && (task->glyphs.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+        {
+            ++task;
+            continue;
+        }
+
+        std::vector<RasterizedGlyph> glyphs = task->glyphs.get();
+        task                                = m_prewarmTasks.erase(task);
+
+        // Glyphs are rasterized one character size after the other, add each run
+        // to new rows at the bottom of its page, so that the whole run can be
+        // uploaded with a single texture update
+        for (auto run = glyphs.begin(); run != glyphs.end();)
+        {
+            const unsigned int characterSize = run->characterSize;
+            const auto         runEnd        = std::find_if(run,
+                                               glyphs.end(),
+                                               [characterSize](const RasterizedGlyph& glyph)
+                                               { return glyph.characterSize != characterSize; });
+
+            Page&              page   = loadPage(characterSize);
+            const unsigned int runTop = page.nextRow;
+            bool               placed = false;
+
+            for (auto it = run; it != runEnd; ++it)
+            {
+                // The glyph may have been loaded meanwhile
+                if (page.glyphs.find(it->key))
+                {
+                    it->pixels.clear();
+                    continue;
+                }
+
+                Glyph& glyph = it->glyph;
+                if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+                {
+                    const unsigned int width  = static_cast<unsigned int>(glyph.textureRect.width) + 2 * glyphPadding;
+                    const unsigned int height = static_cast<unsigned int>(glyph.textureRect.height) + 2 * glyphPadding;
+
+                    glyph.textureRect = findGlyphRect(page, {width, height}, runTop);
+                    glyph.textureRect.left += static_cast<int>(glyphPadding);
+                    glyph.textureRect.top += static_cast<int>(glyphPadding);
+                    glyph.textureRect.width -= static_cast<int>(2 * glyphPadding);
+                    glyph.textureRect.height -= static_cast<int>(2 * glyphPadding);
+                    placed = true;
+                }
+
+                page.glyphs.insert(it->key, glyph);
+            }
+
+            // Gather the pixels of the new rows and upload them at once
+            if (placed && (page.nextRow > runTop))
+            {
+                const Vector2u size(page.texture.getSize().x, page.nextRow - runTop);
+
+                m_pixelBuffer.resize(static_cast<std::size_t>(size.x) * size.y * 4);
+                for (std::size_t i = 0; i < m_pixelBuffer.size(); i += 4)
+                {
+                    m_pixelBuffer[i]     = 255;
+                    m_pixelBuffer[i + 1] = 255;
+                    m_pixelBuffer[i + 2] = 255;
+                    m_pixelBuffer[i + 3] = 0;
+                }
+
+                for (auto it = run; it != runEnd; ++it)
+                {
+                    const IntRect& rect = it->glyph.textureRect;
+
+                    // Skip the glyphs that couldn't be placed in the new rows
+                    if (it->pixels.empty() || (rect.top < static_cast<int>(runTop + glyphPadding)))
+                        continue;
+
+                    const auto left  = static_cast<std::size_t>(rect.left) - glyphPadding;
+                    const auto top   = static_cast<std::size_t>(rect.top) - glyphPadding - runTop;
+                    const auto width = static_cast<std::size_t>(rect.width) + 2 * glyphPadding;
+                    for (std::size_t y = 0; y < static_cast<std::size_t>(rect.height) + 2 * glyphPadding; ++y)
+                    {
+                        std::copy_n(it->pixels.data() + y * width * 4,
+                                    width * 4,
+                                    m_pixelBuffer.data() + ((top + y) * size.x + left) * 4);
+                    }
+                }
+
+                page.texture.update(m_pixelBuffer.data(), size, {0, runTop});
+            }
+
+            run = runEnd;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Font::PrewarmTask::~PrewarmTask()
+{
+    // Stop the background thread, the destructor of the future then waits for it
+    if (cancelled)
+        *cancelled = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadDistanceFieldPage() const
+{
+    // Distance fields must be interpolated to produce smooth edges
+    if (!m_distanceFieldPage)
+        m_distanceFieldPage.emplace(true);
+
+    return *m_distanceFieldPage;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::loadDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const
+{
+    Glyph glyph;
+
+    if (!m_fontHandles)
+        return glyph;
+
+    FT_Face face = m_fontHandles->face;
+    if (!face)
+        return glyph;
+
+    if (!setCurrentSize(DistanceFieldCharacterSize))
+        return glyph;
+
+    if (FT_Load_Char(face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0)
+        return glyph;
+
+    FT_Glyph glyphDesc;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return glyph;
+
+    // Embolden by 2 pixels, which maps to the 1 pixel of regular glyphs at half the reference size
+    const FT_Pos weight  = 2 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (bold && outline)
+        FT_Outline_Embolden(&reinterpret_cast<FT_OutlineGlyph>(glyphDesc)->outline, weight);
+
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    if (bold && !outline)
+        FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    if ((bitmap.width > 0) && (bitmap.rows > 0))
+    {
+        // The field extends beyond the glyph's edges by the spread, plus a transparent
+        // pixel of padding so that filtering doesn't pollute it with neighbors
+        const auto         spread  = static_cast<unsigned int>(DistanceFieldSpread);
+        const unsigned int padding = 1;
+        const unsigned int width   = bitmap.width + 2 * spread;
+        const unsigned int height  = bitmap.rows + 2 * spread;
+
+        // Classify every pixel as inside or outside of the glyph
+        std::vector<bool>   inside(static_cast<std::size_t>(width) * height);
+        const std::uint8_t* pixels = bitmap.buffer;
+        for (unsigned int y = 0; y < bitmap.rows; ++y)
+        {
+            for (unsigned int x = 0; x < bitmap.width; ++x)
+            {
+                const bool covered = (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                                         ? ((pixels[x / 8] & (1 << (7 - (x % 8)))) != 0)
+                                         : (pixels[x] >= 128);
+                inside[(x + spread) + (y + spread) * width] = covered;
+            }
+            pixels += bitmap.pitch;
+        }
+
+        // Compute the distance of every pixel to the nearest pixel on the other side of the edge
+        std::vector<float> distanceToInside(inside.size());
+        std::vector<float> distanceToOutside(inside.size());
+        for (std::size_t i = 0; i < inside.size(); ++i)
+        {
+            distanceToInside[i]  = inside[i] ? 0.f : distanceInfinity;
+            distanceToOutside[i] = inside[i] ? distanceInfinity : 0.f;
+        }
+        squaredDistanceTransform(distanceToInside, width, height);
+        squaredDistanceTransform(distanceToOutside, width, height);
+
+        // Find a good position for the new glyph into the texture
+        Page& page        = loadDistanceFieldPage();
+        glyph.textureRect = findGlyphRect(page, {width + 2 * padding, height + 2 * padding});
+        glyph.textureRect.left += static_cast<int>(padding);
+        glyph.textureRect.top += static_cast<int>(padding);
+        glyph.textureRect.width -= static_cast<int>(2 * padding);
+        glyph.textureRect.height -= static_cast<int>(2 * padding);
+
+        // The glyph's bounding box includes the spread
+        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left) - DistanceFieldSpread;
+        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top) - DistanceFieldSpread;
+        glyph.bounds.width  = static_cast<float>(width);
+        glyph.bounds.height = static_cast<float>(height);
+
+        // Map the signed distance (positive inside) so that the edge lies at 0.5 in the alpha channel,
+        // the pixel centers being half a pixel away from the edge between two pixels
+        m_pixelBuffer.assign(static_cast<std::size_t>(width) * height * 4, 255);
+        for (std::size_t i = 0; i < inside.size(); ++i)
+        {
+            const float distance = inside[i] ? std::sqrt(distanceToOutside[i]) - 0.5f
+                                             : 0.5f - std::sqrt(distanceToInside[i]);
+            const float value    = std::clamp(0.5f + distance / (2.f * DistanceFieldSpread), 0.f, 1.f);
+            m_pixelBuffer[i * 4 + 3] = static_cast<std::uint8_t>(std::lround(value * 255.f));
+        }
+
+        // Write the pixels to the texture, the padding keeps its initial transparent pixels
+        page.texture.update(m_pixelBuffer.data(),
+                            {width, height},
+                            {static_cast<unsigned int>(glyph.textureRect.left),
+                             static_cast<unsigned int>(glyph.textureRect.top)});
+    }
+
+    FT_Done_Glyph(glyphDesc);
+
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader(std::optional<float> outlineThreshold) const
+{
+    // Compile the shaders the first time they are needed
+    if (!m_distanceFieldShaders)
+    {
+        auto shaders    = std::make_shared<DistanceFieldShaders>();
+        shaders->loaded = shaders->fill.loadFromMemory(distanceFieldShaderSource, Shader::Type::Fragment);
+
+        if (shaders->loaded)
+        {
+            shaders->fill.setUniform("texture", Shader::CurrentTexture);
+            shaders->fill.setUniform("threshold", 0.5f);
+        }
+        else
+        {
+            err() << "Failed to compile distance field font shaders" << std::endl;
+        }
+
+        m_distanceFieldShaders = std::move(shaders);
+    }
+
+    if (!m_distanceFieldShaders->loaded)
+        return nullptr;
+
+    // The fill shader never changes, so that draws using it can be batched together
+    if (!outlineThreshold)
+        return &m_distanceFieldShaders->fill;
+
+    // Each threshold has its own shader rather than a uniform changed before every draw, so that
+    // recorded or reordered draws keep their threshold; thresholds are rounded to the precision
+    // of the distance field texture, which bounds the number of shaders
+    const auto threshold = static_cast<std::uint8_t>(std::lround(std::clamp(*outlineThreshold, 0.f, 1.f) * 255.f));
+    const auto [it, inserted] = m_distanceFieldShaders->outlines.try_emplace(threshold);
+    Shader& shader            = it->second;
+
+    if (inserted)
+    {
+        if (shader.loadFromMemory(distanceFieldShaderSource, Shader::Type::Fragment))
+        {
+            shader.setUniform("texture", Shader::CurrentTexture);
+            shader.setUniform("threshold", static_cast<float>(threshold) / 255.f);
+        }
+        else
+        {
+            err() << "Failed to compile distance field font outline shader" << std::endl;
+        }
+    }
+
+    return shader.getNativeHandle() ? &shader : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(Page& page, const Vector2u& size, unsigned int minRowTop) const
 {
     // Find the line that fits well the glyph
     Row*  row       = nullptr;
     float bestRatio = 0;
     for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
     {
+        // Ignore rows above the requested area
+        if (it->top < minRowTop)
+            continue;
+
         const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
 
         // Ignore rows that are either too small or too high
@@ -758,7 +1445,7 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
                     return {{0, 0}, {2, 2}};
                 }
 
-                newTexture.setSmooth(m_isSmooth);
+                newTexture.setSmooth(page.texture.isSmooth());
                 newTexture.update(page.texture);
                 page.texture.swap(newTexture);
             }
@@ -790,42 +1477,107 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
 ////////////////////////////////////////////////////////////
 bool Font::setCurrentSize(unsigned int characterSize) const
 {
-    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
-    // only when necessary to avoid killing performances
-
     // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
-    FT_Face         face        = m_fontHandles->face;
-    const FT_UShort currentSize = face->size->metrics.x_ppem;
+    return setFaceSize(m_fontHandles->face, characterSize);
+}
 
-    if (currentSize != characterSize)
+
+////////////////////////////////////////////////////////////
+Font::GlyphTable::GlyphTable(const GlyphTable& copy) :
+m_glyphCount(copy.m_glyphCount),
+m_slots(copy.m_slots),
+m_latin1(copy.m_latin1)
+{
+    m_chunks.reserve(copy.m_chunks.size());
+    for (const auto& chunk : copy.m_chunks)
+        m_chunks.push_back(std::make_unique<Chunk>(*chunk));
+}
+
+
+////////////////////////////////////////////////////////////
+Font::GlyphTable& Font::GlyphTable::operator=(const GlyphTable& right)
+{
+    GlyphTable temp(right);
+    std::swap(*this, temp);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph* Font::GlyphTable::find(std::uint64_t key) const
+{
+    if (m_slots.empty())
+        return nullptr;
+
+    const Slot& slot = m_slots[findSlot(key)];
+    return (slot.index != 0) ? &getGlyph(slot.index - 1) : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph* Font::GlyphTable::findLatin1(std::uint32_t codePoint, bool bold) const
+{
+    const std::uint32_t index = m_latin1[codePoint + (bold ? Latin1Size : 0)];
+    return (index != 0) ? &getGlyph(index - 1) : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::GlyphTable::insert(std::uint64_t key, const Glyph& glyph)
+{
+    if (const Glyph* existing = find(key))
+        return *existing;
+
+    // Keep the load factor below 3/4, so that probe sequences remain short
+    if ((m_glyphCount + 1) * 4 > m_slots.size() * 3)
     {
-        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+        std::vector<Slot> slots(std::max<std::size_t>(m_slots.size() * 2, 64));
+        std::swap(m_slots, slots);
 
-        if (result == FT_Err_Invalid_Pixel_Size)
+        for (const Slot& slot : slots)
         {
-            // In the case of bitmap fonts, resizing can
-            // fail if the requested size is not available
-            if (!FT_IS_SCALABLE(face))
-            {
-                err() << "Failed to set bitmap font size to " << characterSize << std::endl;
-                err() << "Available sizes are: ";
-                for (int i = 0; i < face->num_fixed_sizes; ++i)
-                {
-                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
-                    err() << size << " ";
-                }
-                err() << std::endl;
-            }
-            else
-            {
-                err() << "Failed to set font size to " << characterSize << std::endl;
-            }
+            if (slot.index != 0)
+                m_slots[findSlot(slot.key)] = slot;
         }
-
-        return result == FT_Err_Ok;
     }
 
-    return true;
+    if (m_glyphCount % ChunkSize == 0)
+        m_chunks.push_back(std::make_unique<Chunk>());
+
+    Glyph& stored = getGlyph(m_glyphCount);
+    stored        = glyph;
+
+    m_slots[findSlot(key)] = {key, ++m_glyphCount};
+
+    return stored;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::GlyphTable::mapLatin1(std::uint32_t codePoint, bool bold, std::uint64_t key)
+{
+    m_latin1[codePoint + (bold ? Latin1Size : 0)] = m_slots[findSlot(key)].index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::GlyphTable::findSlot(std::uint64_t key) const
+{
+    // Mix the bits of the key (Fibonacci hashing), then probe linearly
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t       slot = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15) >> 32) & mask;
+
+    while ((m_slots[slot].index != 0) && (m_slots[slot].key != key))
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph& Font::GlyphTable::getGlyph(std::uint32_t index) const
+{
+    return (*m_chunks[index / ChunkSize])[index % ChunkSize];
 }
 
 
@@ -51,18 +51,26 @@
 #define GLEXT_GL_CLAMP               GL_CLAMP_TO_EDGE
 #define GLEXT_GL_CLAMP_TO_EDGE       GL_CLAMP_TO_EDGE
 
+// Core since 1.0 - compressed textures
+// The supported formats are listed by GL_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_texture_compression               true
+#define GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_TEXTURE_FORMATS     GL_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_glCompressedTexImage2D            glCompressedTexImage2D
+
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object true
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
+#define GLEXT_vertex_buffer_object    true
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -131,6 +139,43 @@
     glRenderbufferStorageMultisampleEXT // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 #define GLEXT_GL_MAX_SAMPLES 0
 
+// Core since 3.0 - OES_element_index_uint
+#define GLEXT_element_index_uint false
+
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range false
+#define GLEXT_GL_MAP_WRITE_BIT 0
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object    false
+#define GLEXT_GL_PIXEL_PACK_BUFFER   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER 0
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync                          false
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    0
+#define GLEXT_GL_TIMEOUT_EXPIRED            0
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_draw_instanced
+#define GLEXT_draw_instanced false
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_instanced_arrays
+#define GLEXT_instanced_arrays false
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 // Core since 3.0 - NV_copy_buffer
 #define GLEXT_copy_buffer          false
 #define GLEXT_GL_COPY_READ_BUFFER  0
@@ -147,6 +192,46 @@
 #define GLEXT_GL_MIN       GL_MIN_EXT
 #define GLEXT_GL_MAX       GL_MAX_EXT
 
+// EXT_texture_compression_s3tc (never core in OpenGL ES, not provided by the loader header)
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1       0x83F1
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5       0x83F3
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+
+// EXT_texture_compression_bptc (never core in OpenGL ES)
+#define GLEXT_texture_compression_bptc            false
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM       GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+
+// Core since 3.0 - ETC2/EAC texture compression
+#define GLEXT_texture_compression_etc2            false
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC        GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+
+// EXT_disjoint_timer_query (never core in OpenGL ES)
+#define GLEXT_timer_query               false
+#define GLEXT_GLuint64                  GLuint64
+#define GLEXT_GL_TIMESTAMP              0
+#define GLEXT_GL_QUERY_RESULT           0
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE 0
+#define GLEXT_glGenQueries \
+    glGenQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteQueries \
+    glDeleteQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glQueryCounter \
+    glQueryCounter // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectiv \
+    glGetQueryObjectiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectui64v \
+    glGetQueryObjectui64v // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.2 - EXT_buffer_storage
+#define GLEXT_buffer_storage        false
+#define GLEXT_GL_MAP_PERSISTENT_BIT 0
+#define GLEXT_GL_MAP_COHERENT_BIT   0
+#define GLEXT_glBufferStorage \
+    glBufferStorage // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -156,6 +241,7 @@
 // Core since 1.1
 #define GLEXT_GL_DEPTH_COMPONENT                  GL_DEPTH_COMPONENT
 #define GLEXT_GL_CLAMP                            GL_CLAMP
+#define GLEXT_element_index_uint                  true
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -185,6 +271,18 @@
 #define GLEXT_glActiveTexture                     glActiveTextureARB
 #define GLEXT_GL_TEXTURE0                         GL_TEXTURE0_ARB
 
+// Core since 1.3 - ARB_texture_compression
+#define GLEXT_texture_compression                 SF_GLAD_GL_VERSION_1_3
+#define GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS   GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_TEXTURE_FORMATS       GL_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_glCompressedTexImage2D              glCompressedTexImage2D
+
+// EXT_texture_compression_s3tc (never core, not provided by the loader header)
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1        0x83F1
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5        0x83F3
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1  GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5  GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+
 // Core since 1.4 - EXT_blend_func_separate
 #define GLEXT_blend_func_separate                 SF_GLAD_GL_EXT_blend_func_separate
 #define GLEXT_glBlendFuncSeparate                 glBlendFuncSeparateEXT
@@ -192,16 +290,19 @@
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object                SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                     GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER             GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                     GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                        GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                      GL_STATIC_DRAW_ARB
 #define GLEXT_GL_STREAM_DRAW                      GL_STREAM_DRAW_ARB
+#define GLEXT_GL_STREAM_READ                      GL_STREAM_READ_ARB
 #define GLEXT_GL_WRITE_ONLY                       GL_WRITE_ONLY_ARB
 #define GLEXT_glBindBuffer                        glBindBufferARB
 #define GLEXT_glBufferData                        glBufferDataARB
 #define GLEXT_glBufferSubData                     glBufferSubDataARB
 #define GLEXT_glDeleteBuffers                     glDeleteBuffersARB
 #define GLEXT_glGenBuffers                        glGenBuffersARB
+#define GLEXT_glGetBufferSubData                  glGetBufferSubDataARB
 #define GLEXT_glMapBuffer                         glMapBufferARB
 #define GLEXT_glUnmapBuffer                       glUnmapBufferARB
 
@@ -246,6 +347,10 @@
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
 
 // Core since 2.0 - ARB_fragment_shader
 #define GLEXT_fragment_shader                     SF_GLAD_GL_ARB_fragment_shader
@@ -262,6 +367,11 @@
 #define GLEXT_texture_sRGB                        SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                     GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object                 SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER                GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER              GL_PIXEL_UNPACK_BUFFER
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                  SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                  glBindRenderbufferEXT
@@ -301,6 +411,15 @@
 #define GLEXT_glRenderbufferStorageMultisample    glRenderbufferStorageMultisampleEXT
 #define GLEXT_GL_MAX_SAMPLES                      GL_MAX_SAMPLES_EXT
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range                    SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_WRITE_BIT                    GL_MAP_WRITE_BIT
+#define GLEXT_glMapBufferRange                    glMapBufferRange
+
+// Core since 3.1 - ARB_draw_instanced
+#define GLEXT_draw_instanced                      SF_GLAD_GL_VERSION_3_1
+#define GLEXT_glDrawArraysInstanced               glDrawArraysInstanced
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer                         SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER                 GL_COPY_READ_BUFFER
@@ -311,6 +430,48 @@
 #define GLEXT_geometry_shader4                    SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER                  GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                                SF_GLAD_GL_ARB_sync
+#define GLEXT_GLsync                              GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE       GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT          GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED                  GL_TIMEOUT_EXPIRED
+#define GLEXT_glFenceSync                         glFenceSync
+#define GLEXT_glClientWaitSync                    glClientWaitSync
+#define GLEXT_glDeleteSync                        glDeleteSync
+
+// Core since 3.3 - ARB_instanced_arrays
+#define GLEXT_instanced_arrays                    SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glVertexAttribDivisor               glVertexAttribDivisor
+
+// Core since 3.3 - ARB_timer_query
+#define GLEXT_timer_query                         (SF_GLAD_GL_VERSION_3_3 || SF_GLAD_GL_ARB_timer_query)
+#define GLEXT_GLuint64                            GLuint64
+#define GLEXT_GL_TIMESTAMP                        GL_TIMESTAMP
+#define GLEXT_GL_QUERY_RESULT                     GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE           GL_QUERY_RESULT_AVAILABLE
+#define GLEXT_glGenQueries                        glGenQueries
+#define GLEXT_glDeleteQueries                     glDeleteQueries
+#define GLEXT_glQueryCounter                      glQueryCounter
+#define GLEXT_glGetQueryObjectiv                  glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v               glGetQueryObjectui64v
+
+// Core since 4.2 - ARB_texture_compression_bptc
+#define GLEXT_texture_compression_bptc            SF_GLAD_GL_VERSION_4_2
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM       GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+
+// Core since 4.3 - ARB_ES3_compatibility
+#define GLEXT_texture_compression_etc2            SF_GLAD_GL_VERSION_4_3
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC        GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+
+// Core since 4.4 - ARB_buffer_storage
+#define GLEXT_buffer_storage                      SF_GLAD_GL_ARB_buffer_storage
+#define GLEXT_GL_MAP_PERSISTENT_BIT               GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT                 GL_MAP_COHERENT_BIT
+#define GLEXT_glBufferStorage                     glBufferStorage
+
 #endif
 
 // OpenGL Versions
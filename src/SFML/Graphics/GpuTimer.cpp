@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GpuTimer.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+GpuTimer::~GpuTimer()
+{
+    // Query objects can only be deleted from the context that created them;
+    // if it isn't active, they are released along with the context itself
+    if (m_queries[0] && (Context::getActiveContextId() == m_contextId))
+        glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuTimer::isAvailable()
+{
+    static const bool available = []() -> bool
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return GLEXT_timer_query;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuTimer::beginFrame()
+{
+    if (m_started || !ensureQueries())
+        return;
+
+    // If the GPU is too many frames behind, wait for the oldest
+    // results rather than overwriting queries still in flight
+    if (m_pending == FrameCount)
+        readResult(true);
+
+    glCheck(GLEXT_glQueryCounter(m_queries[m_next * 2], GLEXT_GL_TIMESTAMP));
+    m_started = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuTimer::endFrame()
+{
+    if (!m_started || !ensureQueries())
+        return;
+
+    glCheck(GLEXT_glQueryCounter(m_queries[m_next * 2 + 1], GLEXT_GL_TIMESTAMP));
+
+    m_next    = (m_next + 1) % FrameCount;
+    m_started = false;
+    ++m_pending;
+
+    // Collect the results which are already available
+    while (m_pending > 0 && readResult(false))
+        ;
+}
+
+
+////////////////////////////////////////////////////////////
+Time GpuTimer::getFrameTime() const
+{
+    return m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuTimer::ensureQueries()
+{
+    if (!m_queries[0])
+    {
+        m_contextId = Context::getActiveContextId();
+        glCheck(GLEXT_glGenQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data()));
+    }
+
+    return Context::getActiveContextId() == m_contextId;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuTimer::readResult(bool wait)
+{
+    const std::size_t  frame      = (m_next + FrameCount - m_pending) % FrameCount;
+    const unsigned int startQuery = m_queries[frame * 2];
+    const unsigned int endQuery   = m_queries[frame * 2 + 1];
+
+    // Queries complete in order, so the start of the frame is available once its end is
+    if (!wait)
+    {
+        GLint available = 0;
+        glCheck(GLEXT_glGetQueryObjectiv(endQuery, GLEXT_GL_QUERY_RESULT_AVAILABLE, &available));
+
+        if (!available)
+            return false;
+    }
+
+    GLEXT_GLuint64 start = 0;
+    GLEXT_GLuint64 end   = 0;
+    glCheck(GLEXT_glGetQueryObjectui64v(startQuery, GLEXT_GL_QUERY_RESULT, &start));
+    glCheck(GLEXT_glGetQueryObjectui64v(endQuery, GLEXT_GL_QUERY_RESULT, &end));
+
+    m_frameTime = microseconds(static_cast<std::int64_t>((end - start) / 1000));
+    --m_pending;
+
+    return true;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Measure the time the GPU spends on each frame
+///
+/// A timestamp query is issued before the first command that
+/// a frame submits, and another one when the frame ends; the
+/// GPU time of the frame is the difference between the two.
+/// Since the GPU is not waiting for a previous frame at that
+/// point, the display period (with vertical synchronization)
+/// and the time it spends idle between frames are not part of
+/// the result. Results are read back a few frames later, once
+/// they are available, so measuring doesn't stall the pipeline.
+///
+/// Query objects are not shared between contexts, so the timer
+/// only works with the context that was active when it was
+/// first used.
+///
+////////////////////////////////////////////////////////////
+class GpuTimer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The query objects are only created on first use.
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuTimer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~GpuTimer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuTimer(const GpuTimer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports timer queries
+    ///
+    /// \return True if timer queries are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the start of a frame
+    ///
+    /// This function must be called with the context of the
+    /// render target active, before each command submitted to
+    /// the GPU. Only the first call of a frame issues a query,
+    /// the following ones return immediately.
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the end of a frame
+    ///
+    /// This function must be called with the context of the
+    /// render target active. It does nothing if no command was
+    /// submitted since the previous call; otherwise it issues
+    /// the query ending the frame, then collects the results
+    /// which became available.
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the GPU time of the last measured frame
+    ///
+    /// \return GPU time between the first command and the end of
+    ///         the most recent frame whose results are available,
+    ///         or Time::Zero if there is none yet
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getFrameTime() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the query objects, or check that their context is active
+    ///
+    /// \return True if the queries can be used in the active context
+    ///
+    ////////////////////////////////////////////////////////////
+    bool ensureQueries();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the results of the oldest pending frame
+    ///
+    /// \param wait True to wait for the results if they aren't available yet
+    ///
+    /// \return True if the results were read
+    ///
+    ////////////////////////////////////////////////////////////
+    bool readResult(bool wait);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t FrameCount{4}; // NOLINT(readability-identifier-naming)
+
+    std::array<unsigned int, FrameCount * 2> m_queries{};   //!< Start and end timestamp queries of each frame (ring)
+    std::uint64_t                            m_contextId{}; //!< Context owning the query objects
+    std::size_t                              m_next{};      //!< Index of the next frame to measure
+    std::size_t                              m_pending{};   //!< Number of ended frames whose results weren't read yet
+    bool                                     m_started{};   //!< Was the start of the next frame already timestamped?
+    Time                                     m_frameTime;   //!< GPU time of the last measured frame
+};
+
+} // namespace sf::priv
@@ -33,7 +33,9 @@
 #include <SFML/System/Android/ResourceStream.hpp>
 #endif
 #include <algorithm>
+#include <atomic>
 #include <ostream>
+#include <thread>
 
 #include <cassert>
 #include <cstring>
@@ -134,6 +136,49 @@ bool Image::loadFromStream(InputStream& stream)
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Image::loadFromFiles(const std::vector<std::filesystem::path>& filenames,
+                                 std::vector<Image>&                       images,
+                                 unsigned int                              threadCount)
+{
+    images.clear();
+    images.resize(filenames.size());
+
+    // Use one thread per hardware thread by default, but never more threads than files
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(std::min<std::size_t>(threadCount, filenames.size()));
+
+    // Each worker repeatedly grabs the next file that nobody is decoding yet
+    std::atomic<std::size_t> nextIndex{0};
+    std::atomic<std::size_t> loadedCount{0};
+    const auto               decode = [&]
+    {
+        for (std::size_t i = nextIndex++; i < filenames.size(); i = nextIndex++)
+        {
+            if (images[i].loadFromFile(filenames[i]))
+                ++loadedCount;
+        }
+    };
+
+    // The calling thread takes part in the decoding too
+    std::vector<std::thread> workers;
+    if (threadCount > 1)
+    {
+        workers.reserve(threadCount - 1);
+        for (unsigned int i = 1; i < threadCount; ++i)
+            workers.emplace_back(decode);
+    }
+
+    decode();
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return loadedCount;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Image::saveToFile(const std::filesystem::path& filename) const
 {
@@ -29,6 +29,7 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -38,8 +39,10 @@
 #include <filesystem>
 #include <iomanip>
 #include <iterator>
+#include <mutex>
 #include <ostream>
 
+#include <climits>
 #include <cstring>
 
 
@@ -71,6 +74,14 @@ void bufferFromCallback(void* context, void* data, int size)
     auto* dest   = static_cast<std::vector<std::uint8_t>*>(context);
     std::copy(source, source + size, std::back_inserter(*dest));
 }
+
+// Images may be decoded on several threads at once (see sf::Image::loadFromFiles),
+// so error reports must not be interleaved
+std::mutex& getErrorMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
 } // namespace
 
 
@@ -99,7 +110,20 @@ bool ImageLoader::loadImageFromFile(const std::filesystem::path& filename, std::
     int            width    = 0;
     int            height   = 0;
     int            channels = 0;
-    unsigned char* ptr      = stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    unsigned char* ptr      = nullptr;
+
+    // Decode the file directly from its memory mapping if possible, to avoid copying it through stdio buffers
+    MappedFileInputStream file;
+    if (file.open(filename) && (file.getSize() > 0) && (file.getSize() <= INT_MAX))
+    {
+        const auto* buffer     = static_cast<const unsigned char*>(file.getData());
+        const auto  bufferSize = static_cast<int>(file.getSize());
+        ptr = stbi_load_from_memory(buffer, bufferSize, &width, &height, &channels, STBI_rgb_alpha);
+    }
+    else
+    {
+        ptr = stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    }
 
     if (ptr)
     {
@@ -122,6 +146,7 @@ bool ImageLoader::loadImageFromFile(const std::filesystem::path& filename, std::
     else
     {
         // Error, failed to load the image
+        const std::lock_guard lock(getErrorMutex());
         err() << "Failed to load image\n"
               << formatDebugPathInfo(filename) << "\nReason: " << stbi_failure_reason() << std::endl;
 
@@ -226,6 +251,7 @@ bool ImageLoader::loadImageFromStream(InputStream& stream, std::vector<std::uint
     else
     {
         // Error, failed to load the image
+        const std::lock_guard lock(getErrorMutex());
         err() << "Failed to load image from stream. Reason: " << stbi_failure_reason() << std::endl;
 
         return false;
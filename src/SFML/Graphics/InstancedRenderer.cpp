@@ -0,0 +1,297 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Instance.hpp>
+#include <SFML/Graphics/InstancedRenderer.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cstddef>
+#include <cstring>
+
+#ifndef SFML_OPENGL_ES
+
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+
+#define castToGlHandle(x) reinterpret_cast<GLEXT_GLhandle>(static_cast<ptrdiff_t>(x))
+
+#else
+
+#define castToGlHandle(x) (x)
+
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace InstancedRendererImpl
+{
+// Transform each vertex by the transform of its instance, then by the usual modelview-projection matrix
+constexpr const char* vertexShader = R"(
+attribute vec3 sf_instanceRow0;
+attribute vec3 sf_instanceRow1;
+attribute vec4 sf_instanceColor;
+
+void main()
+{
+    vec3 position = vec3(gl_Vertex.xy, 1.0);
+    vec2 transformed = vec2(dot(sf_instanceRow0, position), dot(sf_instanceRow1, position));
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(transformed, 0.0, 1.0);
+    gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+    gl_FrontColor = gl_Color * sf_instanceColor;
+}
+)";
+
+// Same as the fixed-function pipeline, modulate the texture by the vertex color
+constexpr const char* fragmentShader = R"(
+uniform sampler2D sf_texture;
+uniform float sf_textured;
+
+void main()
+{
+    vec4 texel = texture2D(sf_texture, gl_TexCoord[0].xy);
+    gl_FragColor = gl_Color * mix(vec4(1.0), texel, sf_textured);
+}
+)";
+} // namespace InstancedRendererImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+InstancedRenderer::~InstancedRenderer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstancedRenderer::isAvailable()
+{
+    static const bool available = []()
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return Shader::isAvailable() && VertexBuffer::isAvailable() && GLEXT_draw_instanced && GLEXT_instanced_arrays;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* InstancedRenderer::getShader(bool textured)
+{
+    if (!m_created)
+    {
+        m_created = true;
+        m_valid   = create();
+    }
+
+    if (!m_valid)
+        return nullptr;
+
+    m_shader.setUniform("sf_textured", textured ? 1.f : 0.f);
+
+    return &m_shader;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstancedRenderer::bind(const Instance* instances, std::size_t instanceCount)
+{
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Grow the buffer if needed, its previous contents are lost
+    if (instanceCount > m_capacity)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(PackedInstance) * instanceCount),
+                                   nullptr,
+                                   GLEXT_GL_DYNAMIC_DRAW));
+
+        m_capacity = instanceCount;
+        m_packedInstances.clear();
+    }
+
+    // Extract the 2D part of the transforms, this is all the shader needs, and
+    // find the range of instances which changed since they were last uploaded
+    const std::size_t uploadedCount = m_packedInstances.size();
+    std::size_t       firstChanged  = instanceCount;
+    std::size_t       lastChanged   = 0;
+
+    m_packedInstances.resize(instanceCount);
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        const float*         matrix = instances[i].transform.getMatrix();
+        const PackedInstance packed = {{matrix[0], matrix[4], matrix[12]},
+                                       {matrix[1], matrix[5], matrix[13]},
+                                       instances[i].color};
+
+        if ((i >= uploadedCount) || (std::memcmp(&packed, &m_packedInstances[i], sizeof(PackedInstance)) != 0))
+        {
+            m_packedInstances[i] = packed;
+            firstChanged         = std::min(firstChanged, i);
+            lastChanged          = i + 1;
+        }
+    }
+
+    if (firstChanged < lastChanged)
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(PackedInstance) * firstChanged),
+                                      static_cast<GLsizeiptrARB>(sizeof(PackedInstance) * (lastChanged - firstChanged)),
+                                      m_packedInstances.data() + firstChanged));
+    }
+
+    const auto stride = static_cast<GLsizei>(sizeof(PackedInstance));
+    const auto* row0  = reinterpret_cast<const void*>(offsetof(PackedInstance, row0));
+    const auto* row1  = reinterpret_cast<const void*>(offsetof(PackedInstance, row1));
+    const auto* color = reinterpret_cast<const void*>(offsetof(PackedInstance, color));
+
+    glCheck(GLEXT_glVertexAttribPointer(m_locations[0], 3, GL_FLOAT, GL_FALSE, stride, row0));
+    glCheck(GLEXT_glVertexAttribPointer(m_locations[1], 3, GL_FLOAT, GL_FALSE, stride, row1));
+    glCheck(GLEXT_glVertexAttribPointer(m_locations[2], 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, color));
+
+    for (const unsigned int location : m_locations)
+    {
+        glCheck(GLEXT_glEnableVertexAttribArray(location));
+        glCheck(GLEXT_glVertexAttribDivisor(location, 1));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void InstancedRenderer::unbind()
+{
+    for (const unsigned int location : m_locations)
+    {
+        glCheck(GLEXT_glVertexAttribDivisor(location, 0));
+        glCheck(GLEXT_glDisableVertexAttribArray(location));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstancedRenderer::create()
+{
+    if (!m_shader.loadFromMemory(InstancedRendererImpl::vertexShader, InstancedRendererImpl::fragmentShader))
+    {
+        err() << "Failed to compile the instancing shader" << std::endl;
+        return false;
+    }
+
+    m_shader.setUniform("sf_texture", Shader::CurrentTexture);
+
+    const char* names[] = {"sf_instanceRow0", "sf_instanceRow1", "sf_instanceColor"};
+    for (std::size_t i = 0; i < m_locations.size(); ++i)
+    {
+        GLint location = -1;
+        glCheck(location = GLEXT_glGetAttribLocation(castToGlHandle(m_shader.getNativeHandle()), names[i]));
+
+        if (location == -1)
+        {
+            err() << "Failed to find the attribute \"" << names[i] << "\" in the instancing shader" << std::endl;
+            return false;
+        }
+
+        m_locations[i] = static_cast<unsigned int>(location);
+    }
+
+    glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create instance buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
+
+#else // SFML_OPENGL_ES
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+InstancedRenderer::~InstancedRenderer() = default;
+
+
+////////////////////////////////////////////////////////////
+bool InstancedRenderer::isAvailable()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* InstancedRenderer::getShader(bool /* textured */)
+{
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstancedRenderer::bind(const Instance* /* instances */, std::size_t /* instanceCount */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void InstancedRenderer::unbind()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstancedRenderer::create()
+{
+    return false;
+}
+
+} // namespace sf::priv
+
+#endif // SFML_OPENGL_ES
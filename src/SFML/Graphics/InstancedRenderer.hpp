@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+struct Instance;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Hardware instancing support for RenderTarget::drawInstanced
+///
+/// The fixed-function pipeline has no notion of per-instance
+/// attributes, so instances are rendered through an internal
+/// shader which reads the transform and color of each instance
+/// from generic vertex attributes advancing once per instance.
+///
+////////////////////////////////////////////////////////////
+class InstancedRenderer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The shader and the instance buffer are only created on first use.
+    ///
+    ////////////////////////////////////////////////////////////
+    InstancedRenderer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~InstancedRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    InstancedRenderer(const InstancedRenderer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    InstancedRenderer& operator=(const InstancedRenderer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports hardware instancing
+    ///
+    /// \return True if hardware instancing is supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader to draw instances with
+    ///
+    /// The shader is compiled on first call, which must
+    /// happen with the context of the render target active.
+    ///
+    /// \param textured Will the instances be drawn with a texture?
+    ///
+    /// \return Pointer to the shader, or a null pointer if it failed to compile
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getShader(bool textured);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the instances and bind them to the shader attributes
+    ///
+    /// The instance buffer persists between draws, and only the
+    /// range of instances which differ from the previous upload
+    /// is sent to the graphics card. The instance buffer is left
+    /// bound to GL_ARRAY_BUFFER.
+    ///
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind(const Instance* instances, std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disable the per-instance attributes enabled by bind
+    ///
+    ////////////////////////////////////////////////////////////
+    void unbind();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compile the shader and create the instance buffer
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Instance attributes, in the layout expected by the shader
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PackedInstance
+    {
+        std::array<float, 3> row0;  //!< First row of the 2D transform
+        std::array<float, 3> row1;  //!< Second row of the 2D transform
+        Color                color; //!< Color of the instance
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Shader                      m_shader;          //!< Shader reading the instance attributes
+    bool                        m_created{};       //!< Did we already try to create the shader and the buffer?
+    bool                        m_valid{};         //!< Were the shader and the buffer successfully created?
+    unsigned int                m_buffer{};        //!< Buffer holding the packed instances
+    std::size_t                 m_capacity{};      //!< Number of instances the buffer can hold
+    std::array<unsigned int, 3> m_locations{};     //!< Locations of the row0, row1 and color attributes
+    std::vector<PackedInstance> m_packedInstances; //!< Copy of the instances currently in the buffer
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -25,10 +25,16 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandBuffer.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GpuTimer.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Instance.hpp>
+#include <SFML/Graphics/InstancedRenderer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/StreamingVertexBuffer.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
@@ -39,13 +45,17 @@
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace
@@ -85,6 +95,24 @@ bool isActive(std::uint64_t id)
     return (it != getContextRenderTargetMap().end()) && (it->second == id);
 }
 
+// Check if a rectangle overlaps the area covered by a view; the
+// test is inclusive so that degenerate shapes like lines are kept
+bool isVisible(const sf::FloatRect& bounds, const sf::View& view)
+{
+    const sf::FloatRect area = view.getInverseTransform().transformRect(sf::FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+
+    return (bounds.left <= area.left + area.width) && (bounds.left + bounds.width >= area.left) &&
+           (bounds.top <= area.top + area.height) && (bounds.top + bounds.height >= area.top);
+}
+
+// Convert an sf::PrimitiveType constant to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
 std::uint32_t factorToGlConstant(sf::BlendMode::Factor blendFactor)
 {
@@ -153,11 +181,36 @@ std::uint32_t equationToGlConstant(sf::BlendMode::Equation blendEquation)
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
+    if (record(color))
+        return;
+
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
+        // Timestamp the first command of the frame for GPU timing
+        if (m_gpuTimer)
+            m_gpuTimer->beginFrame();
+
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
 
@@ -170,8 +223,13 @@ void RenderTarget::clear(const Color& color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending geometry must be rendered with the view that was active when it was drawn
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
+
+    record(view);
 }
 
 
@@ -247,7 +305,34 @@ Vector2i RenderTarget::mapCoordsToPixel(const Vector2f& point, const View& view)
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
 {
+    // Skip drawables which are entirely outside of the view; shaders may move
+    // vertices anywhere, so the bounds can't be trusted when one is used.
+    // The parts drawn by a drawable which passed the test are inside of its
+    // bounds, so they don't need to be tested again.
+    bool tested = false;
+    if (m_cullingEnabled && !states.shader && (m_testedDrawables == 0))
+    {
+        if (const std::optional<FloatRect> bounds = drawable.getCullingBounds())
+        {
+            if (!RenderTargetImpl::isVisible(states.transform.transformRect(*bounds), m_view))
+            {
+                ++m_statistics.culledDrawables;
+                return;
+            }
+
+            tested = true;
+        }
+    }
+
+    ++m_statistics.drawnDrawables;
+
+    if (tested)
+        ++m_testedDrawables;
+
     drawable.draw(*this, states);
+
+    if (tested)
+        --m_testedDrawables;
 }
 
 
@@ -258,77 +343,92 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (record(vertices, vertexCount, type, states))
+        return;
+
+    if (m_batch.enabled)
+        batchVertices(vertices, vertexCount, type, states);
+    else
+        drawVertices(vertices, vertexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
     {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize);
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
 
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
 
-        setupDraw(useVertexCache, states);
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
 
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle())
+        return;
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+    if (record(vertexBuffer, firstVertex, vertexCount, states))
+        return;
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache);
+    // Render the pending batched geometry first to preserve the drawing order
+    flush();
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache);
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
 
-        drawPrimitives(type, 0, vertexCount);
         cleanupDraw(states);
 
         // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
 {
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
 {
     // VertexBuffer not supported?
     if (!VertexBuffer::isAvailable())
@@ -338,20 +438,117 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     }
 
     // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
+    if (firstIndex > indexBuffer.getIndexCount())
         return;
 
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
 
     // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    if (record(vertexBuffer, indexBuffer, firstIndex, indexCount, states))
         return;
 
+    // Render the pending batched geometry first to preserve the drawing order
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         setupDraw(false, states);
 
+        // Bind vertex and index buffers
+        VertexBuffer::bind(&vertexBuffer);
+        IndexBuffer::bind(&indexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        // Find the OpenGL index type, the offset of the first index is given in bytes
+        const bool        wideIndices = (indexBuffer.getIndexType() == IndexBuffer::UInt32);
+        const GLenum      indexType   = wideIndices ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+        const std::size_t indexSize   = wideIndices ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+
+        ++m_statistics.drawCalls;
+        m_statistics.vertices += indexCount;
+
+        glCheck(glDrawElements(RenderTargetImpl::primitiveTypeToGlConstant(vertexBuffer.getPrimitiveType()),
+                               static_cast<GLsizei>(indexCount),
+                               indexType,
+                               reinterpret_cast<const void*>(firstIndex * indexSize)));
+
+        // Unbind vertex and index buffers
+        IndexBuffer::bind(nullptr);
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const CommandBuffer& commandBuffer)
+{
+    commandBuffer.replay(*this, 0, commandBuffer.getCommandCount());
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const VertexBuffer& vertexBuffer,
+                                 const Instance*     instances,
+                                 std::size_t         instanceCount,
+                                 const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Nothing to draw?
+    if (!instances || !instanceCount || !vertexBuffer.getVertexCount() || !vertexBuffer.getNativeHandle())
+        return;
+
+    if (record(vertexBuffer, instances, instanceCount, states))
+        return;
+
+    // Render the pending batched geometry first to preserve the drawing order
+    flush();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // Use hardware instancing if possible, it needs its own shader
+        const Shader* shader = nullptr;
+        if (!states.shader && priv::InstancedRenderer::isAvailable())
+        {
+            if (!m_instancedRenderer)
+                m_instancedRenderer = std::make_unique<priv::InstancedRenderer>();
+
+            shader = m_instancedRenderer->getShader(states.texture != nullptr);
+        }
+
+        if (!shader)
+        {
+            drawExpandedInstances(vertexBuffer, instances, instanceCount, states);
+            return;
+        }
+
+        RenderStates instancedStates = states;
+        instancedStates.shader       = shader;
+
+        setupDraw(false, instancedStates);
+
         // Bind vertex buffer
         VertexBuffer::bind(&vertexBuffer);
 
@@ -363,12 +560,24 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
         glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        // Upload the instances and bind them to the per-instance attributes of the shader
+        m_instancedRenderer->bind(instances, instanceCount);
+
+        ++m_statistics.drawCalls;
+        m_statistics.vertices += vertexBuffer.getVertexCount() * instanceCount;
+
+        const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(vertexBuffer.getPrimitiveType());
+        glCheck(GLEXT_glDrawArraysInstanced(mode,
+                                            0,
+                                            static_cast<GLsizei>(vertexBuffer.getVertexCount()),
+                                            static_cast<GLsizei>(instanceCount)));
+
+        m_instancedRenderer->unbind();
 
         // Unbind vertex buffer
         VertexBuffer::bind(nullptr);
 
-        cleanupDraw(states);
+        cleanupDraw(instancedStates);
 
         // Update the cache
         m_cache.useVertexCache        = false;
@@ -377,6 +586,104 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    // Nothing to draw?
+    if (m_batch.vertices.empty())
+        return;
+
+    // Take the vertices out of the batch before drawing them, so
+    // that nothing called from here can flush them a second time
+    std::vector<Vertex> vertices;
+    vertices.swap(m_batch.vertices);
+
+    drawVertices(vertices.data(), vertices.size(), m_batch.type, m_batch.states);
+
+    // Hand the storage back to the batch so that it doesn't have to grow again
+    vertices.clear();
+    m_batch.vertices.swap(vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setVertexStreamingEnabled(bool enabled)
+{
+    if (enabled && !m_streamingBuffer && priv::StreamingVertexBuffer::isAvailable())
+        m_streamingBuffer = std::make_unique<priv::StreamingVertexBuffer>();
+    else if (!enabled)
+        m_streamingBuffer.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isVertexStreamingEnabled() const
+{
+    return m_streamingBuffer != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::Statistics& RenderTarget::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetStatistics()
+{
+    // Mark the end of the frame for GPU timing, but only on targets which
+    // were drawn to, so that a context isn't created just for statistics;
+    // the timer is created by the first call, and measures the next frames
+    if (m_cache.glStatesSet && priv::GpuTimer::isAvailable() && (RenderTargetImpl::isActive(m_id) || setActive(true)))
+    {
+        flush();
+
+        if (!m_gpuTimer)
+            m_gpuTimer = std::make_unique<priv::GpuTimer>();
+
+        m_gpuTimer->endFrame();
+    }
+
+    m_statistics = Statistics();
+
+    if (m_gpuTimer)
+        m_statistics.gpuTime = m_gpuTimer->getFrameTime();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -406,12 +713,16 @@ bool RenderTarget::setActive(bool active)
 
                 m_cache.glStatesSet = false;
                 m_cache.enable      = false;
+
+                ++m_statistics.contextSwitches;
             }
             else if (it->second != m_id)
             {
                 it->second = m_id;
 
                 m_cache.enable = false;
+
+                ++m_statistics.contextSwitches;
             }
         }
         else
@@ -430,6 +741,8 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -480,6 +793,9 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    // Render the pending batched geometry while our states are still valid
+    flush();
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -526,7 +842,10 @@ void RenderTarget::resetGLStates()
             applyShader(nullptr);
 
         if (vertexBufferAvailable)
+        {
             glCheck(VertexBuffer::bind(nullptr));
+            glCheck(IndexBuffer::bind(nullptr));
+        }
 
         m_cache.texCoordsArrayEnabled = true;
 
@@ -556,6 +875,60 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::record(const Vertex* /* vertices */,
+                          std::size_t /* vertexCount */,
+                          PrimitiveType /* type */,
+                          const RenderStates& /* states */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::record(const VertexBuffer& /* vertexBuffer */,
+                          std::size_t /* firstVertex */,
+                          std::size_t /* vertexCount */,
+                          const RenderStates& /* states */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::record(const VertexBuffer& /* vertexBuffer */,
+                          const IndexBuffer& /* indexBuffer */,
+                          std::size_t /* firstIndex */,
+                          std::size_t /* indexCount */,
+                          const RenderStates& /* states */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::record(const VertexBuffer& /* vertexBuffer */,
+                          const Instance* /* instances */,
+                          std::size_t /* instanceCount */,
+                          const RenderStates& /* states */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::record(const Color& /* color */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::record(const View& /* view */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
@@ -625,6 +998,8 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    ++m_statistics.blendModeChanges;
 }
 
 
@@ -646,6 +1021,8 @@ void RenderTarget::applyTexture(const Texture* texture)
     Texture::bind(texture, Texture::Pixels);
 
     m_cache.lastTextureId = texture ? texture->m_cacheId : 0;
+
+    ++m_statistics.textureChanges;
 }
 
 
@@ -653,12 +1030,247 @@ void RenderTarget::applyTexture(const Texture* texture)
 void RenderTarget::applyShader(const Shader* shader)
 {
     Shader::bind(shader);
+
+    ++m_statistics.shaderChanges;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // Check if the vertex count is low enough so that we can pre-transform them
+        const bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize);
+
+        if (useVertexCache)
+        {
+            ++m_statistics.vertexCacheHits;
+
+            // Pre-transform the vertices and store them into the vertex cache
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                Vertex& vertex   = m_cache.vertexCache[i];
+                vertex.position  = states.transform * vertices[i].position;
+                vertex.color     = vertices[i].color;
+                vertex.texCoords = vertices[i].texCoords;
+            }
+        }
+        else
+        {
+            ++m_statistics.vertexCacheMisses;
+        }
+
+        setupDraw(useVertexCache, states);
+
+        // Stream the vertices through our ring buffer if enabled, and use client-side arrays otherwise
+        const Vertex* source = useVertexCache ? m_cache.vertexCache : vertices;
+        if (m_streamingBuffer && drawStreamedPrimitives(source, vertexCount, type))
+        {
+            cleanupDraw(states);
+            return;
+        }
+
+        // Check if texture coordinates array is needed, and update client state accordingly
+        const bool enableTexCoordsArray = (states.texture || states.shader);
+        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+        {
+            if (enableTexCoordsArray)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            else
+                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
+        // If we switch between non-cache and cache mode or enable texture
+        // coordinates we need to set up the pointers to the vertices' components
+        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        {
+            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+            // If we pre-transform the vertices, we must use our internal vertex cache
+            if (useVertexCache)
+                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache);
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+            if (enableTexCoordsArray)
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+        {
+            // If we enter this block, we are already using our internal vertex cache
+            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache);
+
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+
+        drawPrimitives(type, 0, vertexCount);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = useVertexCache;
+        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::drawStreamedPrimitives(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type)
+{
+    const std::optional<std::size_t> firstVertex = m_streamingBuffer->write(vertices, vertexCount);
+
+    if (!firstVertex)
+        return false;
+
+    // The streaming buffer is now bound, so the pointers are offsets into it
+    if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+    glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+    glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+    drawPrimitives(type, *firstVertex, vertexCount);
+
+    // Client-side arrays require that no buffer is bound
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    // Update the cache, the pointers no longer refer to the vertex cache
+    m_cache.useVertexCache        = false;
+    m_cache.texCoordsArrayEnabled = true;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawExpandedInstances(const VertexBuffer& vertexBuffer,
+                                         const Instance*     instances,
+                                         std::size_t         instanceCount,
+                                         const RenderStates& states)
+{
+    RenderStates instanceStates = states;
+
+#ifndef SFML_OPENGL_ES
+
+    // Read the geometry back from the vertex buffer, unless it didn't change since the last time
+    std::vector<Vertex>& geometry = m_instanceGeometry.vertices;
+    if (m_instanceGeometry.cacheId != vertexBuffer.m_cacheId)
+    {
+        geometry.resize(vertexBuffer.getVertexCount());
+        VertexBuffer::bind(&vertexBuffer);
+        glCheck(GLEXT_glGetBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                         0,
+                                         static_cast<GLsizeiptrARB>(sizeof(Vertex) * geometry.size()),
+                                         geometry.data()));
+        VertexBuffer::bind(nullptr);
+
+        m_instanceGeometry.cacheId = vertexBuffer.m_cacheId;
+    }
+
+    // Accumulate all the instances in the batch, which will render them with a single draw call
+    std::vector<Vertex> instanceVertices(geometry.size());
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        for (std::size_t j = 0; j < geometry.size(); ++j)
+        {
+            instanceVertices[j]       = geometry[j];
+            instanceVertices[j].color = geometry[j].color * instances[i].color;
+        }
+
+        instanceStates.transform = states.transform * instances[i].transform;
+        batchVertices(instanceVertices.data(),
+                      instanceVertices.size(),
+                      vertexBuffer.getPrimitiveType(),
+                      instanceStates);
+    }
+
+    if (!m_batch.enabled)
+        flush();
+
+#else
+
+    // The geometry can't be read back, draw the instances one by one
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        instanceStates.transform = states.transform * instances[i].transform;
+        draw(vertexBuffer, instanceStates);
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::batchVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    // Strips and fans can't be merged with each other, convert them to their list equivalent
+    PrimitiveType batchType = type;
+    if (type == PrimitiveType::LineStrip)
+        batchType = PrimitiveType::Lines;
+    else if ((type == PrimitiveType::TriangleStrip) || (type == PrimitiveType::TriangleFan))
+        batchType = PrimitiveType::Triangles;
+
+    // Render the pending geometry first if it can't be merged with the new one
+    const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
+    if ((batchType != m_batch.type) || (textureId != m_batch.textureId) || (states.shader != m_batch.states.shader) ||
+        (states.blendMode != m_batch.states.blendMode))
+    {
+        flush();
+
+        m_batch.type             = batchType;
+        m_batch.states.blendMode = states.blendMode;
+        m_batch.states.texture   = states.texture;
+        m_batch.states.shader    = states.shader;
+        m_batch.textureId        = textureId;
+    }
+
+    // Pre-transform the vertices, since the batch is rendered with an identity transform
+    const auto append = [this, &states](const Vertex& vertex)
+    { m_batch.vertices.emplace_back(states.transform * vertex.position, vertex.color, vertex.texCoords); };
+
+    switch (type)
+    {
+        case PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[i - 2]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[0]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case PrimitiveType::Points:
+        case PrimitiveType::Lines:
+        case PrimitiveType::Triangles:
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                append(vertices[i]);
+            break;
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 {
+    // Timestamp the first command of the frame for GPU timing
+    if (m_gpuTimer)
+        m_gpuTimer->beginFrame();
+
     // Enable or disable sRGB encoding
     // This is needed for drivers that do not check the format of the surface drawn to before applying sRGB conversion
     if (!m_cache.enable)
@@ -720,10 +1332,12 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum            mode = modes[static_cast<std::size_t>(type)];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
 
     // Draw the primitives
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += vertexCount;
+
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
 }
 
@@ -160,6 +160,9 @@ void RenderTexture::display()
 {
     if (m_impl)
     {
+        // Render the pending batched geometry before the texture gets updated
+        flush();
+
         if (priv::RenderTextureImplFBO::isAvailable())
         {
             // Perform a RenderTarget-only activation if we are using FBOs
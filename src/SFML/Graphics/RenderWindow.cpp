@@ -125,4 +125,12 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    // Render the pending batched geometry before presenting the frame
+    flush();
+}
+
 } // namespace sf
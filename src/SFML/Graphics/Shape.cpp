@@ -255,6 +255,13 @@ void Shape::draw(RenderTarget& target, const RenderStates& states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Shape::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shape::updateFillColors()
 {
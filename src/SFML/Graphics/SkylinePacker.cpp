@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SkylinePacker.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+SkylinePacker::SkylinePacker(const Vector2u& size) : m_size(size)
+{
+    m_skyline.push_back({0, 0, size.x});
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> SkylinePacker::insert(const Vector2u& size)
+{
+    if (size.x == 0 || size.y == 0)
+        return std::nullopt;
+
+    // Find the segment where the rectangle lands the lowest,
+    // prefer the narrowest segment to limit the wasted space
+    std::optional<std::size_t> bestIndex;
+    unsigned int               bestBottom = 0;
+    unsigned int               bestWidth  = 0;
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        const std::optional<unsigned int> y = fit(i, size);
+        if (!y)
+            continue;
+
+        const unsigned int bottom = *y + size.y;
+        if (!bestIndex || (bottom < bestBottom) || ((bottom == bestBottom) && (m_skyline[i].width < bestWidth)))
+        {
+            bestIndex  = i;
+            bestBottom = bottom;
+            bestWidth  = m_skyline[i].width;
+        }
+    }
+
+    if (!bestIndex)
+        return std::nullopt;
+
+    const Vector2u position(m_skyline[*bestIndex].x, bestBottom - size.y);
+
+    // Insert the new segment on top of the rectangle
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(*bestIndex), {position.x, bestBottom, size.x});
+
+    // Shrink or remove the segments now covered by the rectangle
+    const unsigned int right = position.x + size.x;
+    for (std::size_t i = *bestIndex + 1; i < m_skyline.size();)
+    {
+        Segment& segment = m_skyline[i];
+        if (segment.x >= right)
+            break;
+
+        const unsigned int segmentRight = segment.x + segment.width;
+        if (segmentRight <= right)
+        {
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+
+        segment.width = segmentRight - right;
+        segment.x     = right;
+        break;
+    }
+
+    // Merge neighbour segments that have the same height
+    for (std::size_t i = 0; i + 1 < m_skyline.size();)
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return position;
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::grow(const Vector2u& size)
+{
+    assert(size.x >= m_size.x && size.y >= m_size.y && "The packing area can't shrink");
+
+    // The extra columns are empty, so they form a segment at the bottom of the skyline
+    if (size.x > m_size.x)
+    {
+        if (m_skyline.back().y == 0)
+            m_skyline.back().width += size.x - m_size.x;
+        else
+            m_skyline.push_back({m_size.x, 0, size.x - m_size.x});
+    }
+
+    m_size = size;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& SkylinePacker::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<unsigned int> SkylinePacker::fit(std::size_t index, const Vector2u& size) const
+{
+    const unsigned int left = m_skyline[index].x;
+    if (left + size.x > m_size.x)
+        return std::nullopt;
+
+    // The rectangle rests on the highest segment below it
+    unsigned int y         = 0;
+    unsigned int remaining = size.x;
+    for (std::size_t i = index; remaining > 0; ++i)
+    {
+        y = std::max(y, m_skyline[i].y);
+        if (y + size.y > m_size.y)
+            return std::nullopt;
+
+        remaining -= std::min(remaining, m_skyline[i].width);
+    }
+
+    return y;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Packer placing rectangles into a 2D area
+///
+/// The packer keeps track of the skyline formed by the top
+/// edges of the rectangles already placed, and puts every new
+/// rectangle at the lowest position of the skyline where it
+/// fits (bottom-left rule, with y growing downwards).
+///
+////////////////////////////////////////////////////////////
+class SkylinePacker
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packer
+    ///
+    /// \param size Size of the area to fill
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SkylinePacker(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a place for a new rectangle
+    ///
+    /// \param size Size of the rectangle to place
+    ///
+    /// \return Position of the rectangle, or std::nullopt if it doesn't fit
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<Vector2u> insert(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enlarge the area to fill
+    ///
+    /// The rectangles already placed keep their position.
+    ///
+    /// \param size New size of the area, must not be smaller than the current one
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area to fill
+    ///
+    /// \return Size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        unsigned int x{};     //!< Left position of the segment
+        unsigned int y{};     //!< Height of the skyline over the segment
+        unsigned int width{}; //!< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute where a rectangle would be placed if it started at a given segment
+    ///
+    /// \param index Index of the segment where the rectangle starts
+    /// \param size  Size of the rectangle to place
+    ///
+    /// \return Vertical position of the rectangle, or std::nullopt if it doesn't fit
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<unsigned int> fit(std::size_t index, const Vector2u& size) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;    //!< Size of the area to fill
+    std::vector<Segment> m_skyline; //!< Segments of the skyline, sorted from left to right
+};
+
+} // namespace sf::priv
@@ -138,6 +138,13 @@ void Sprite::draw(RenderTarget& target, const RenderStates& states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Sprite::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Sprite::updatePositions()
 {
@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/StreamingVertexBuffer.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+
+#include <cstring>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+StreamingVertexBuffer::~StreamingVertexBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        for (const GLEXT_GLsync fence : m_fences)
+        {
+            if (fence)
+                glCheck(GLEXT_glDeleteSync(fence));
+        }
+
+        // Deleting the buffer implicitly unmaps it
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingVertexBuffer::isAvailable()
+{
+    return VertexBuffer::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> StreamingVertexBuffer::write(const Vertex* vertices, std::size_t vertexCount)
+{
+    // Too many vertices to fit in a region, let the caller use another path
+    if (vertexCount > RegionSize)
+        return std::nullopt;
+
+    if (!m_buffer && !create())
+        return std::nullopt;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    if (m_offset + vertexCount > RegionSize)
+        nextRegion();
+
+    const std::size_t first = m_region * RegionSize + m_offset;
+
+    if (m_mapping)
+    {
+        std::memcpy(m_mapping + first, vertices, sizeof(Vertex) * vertexCount);
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(Vertex) * first),
+                                      static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                      vertices));
+    }
+
+    m_offset += vertexCount;
+
+    return first;
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamingVertexBuffer::create()
+{
+    glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create streaming vertex buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Prefer a persistently mapped buffer, which lets us write vertices without any driver call
+    if (GLEXT_buffer_storage && GLEXT_map_buffer_range && GLEXT_sync)
+    {
+        const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
+        const auto       size  = static_cast<GLsizeiptr>(sizeof(Vertex) * VertexCount);
+
+        glCheck(GLEXT_glBufferStorage(GLEXT_GL_ARRAY_BUFFER, size, nullptr, flags));
+        glCheck(m_mapping = static_cast<Vertex*>(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER, 0, size, flags)));
+
+        if (m_mapping)
+            return true;
+
+        // Storage of the buffer is immutable, start over with a new one
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+        if (!m_buffer)
+        {
+            err() << "Could not create streaming vertex buffer, generation failed" << std::endl;
+            return false;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    }
+
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * VertexCount),
+                               nullptr,
+                               GLEXT_GL_STREAM_DRAW));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingVertexBuffer::nextRegion()
+{
+    if (m_mapping)
+    {
+        // Mark the point after which the GPU is done reading from the current region
+        glCheck(m_fences[m_region] = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        m_region = (m_region + 1) % RegionCount;
+        m_offset = 0;
+
+        // Wait until the GPU is done reading from the region we are about to overwrite
+        if (GLEXT_GLsync& fence = m_fences[m_region])
+        {
+            GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+            while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+                glCheck(result = GLEXT_glClientWaitSync(fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000));
+
+            glCheck(GLEXT_glDeleteSync(fence));
+            fence = nullptr;
+        }
+    }
+    else
+    {
+        m_region = (m_region + 1) % RegionCount;
+        m_offset = 0;
+
+        // When wrapping around, orphan the buffer so that the driver hands
+        // us fresh storage instead of waiting for pending draws to complete
+        if (m_region == 0)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(sizeof(Vertex) * VertexCount),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_DRAW));
+        }
+    }
+}
+
+} // namespace sf::priv
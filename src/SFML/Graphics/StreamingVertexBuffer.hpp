@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring buffer used to stream vertices to the graphics card
+///
+/// Vertices are written one after the other into a large
+/// buffer object. When the hardware supports it, the buffer
+/// is mapped persistently and split into regions guarded by
+/// fences, so that we never overwrite vertices the GPU is
+/// still reading from. Otherwise the buffer is orphaned when
+/// it is full and filled with glBufferSubData.
+///
+////////////////////////////////////////////////////////////
+class StreamingVertexBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The buffer object is only created on first use.
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingVertexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamingVertexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingVertexBuffer(const StreamingVertexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingVertexBuffer& operator=(const StreamingVertexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports streaming vertex buffers
+    ///
+    /// \return True if streaming vertex buffers are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy vertices to the next free space of the ring
+    ///
+    /// This function must be called with the context of the
+    /// render target active. On success, the buffer is left
+    /// bound to GL_ARRAY_BUFFER so that the vertex pointers
+    /// can be set up right away.
+    ///
+    /// \param vertices    Pointer to the vertices to copy
+    /// \param vertexCount Number of vertices to copy
+    ///
+    /// \return Index of the first copied vertex in the buffer, or
+    ///         std::nullopt if the vertices couldn't be streamed
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::size_t> write(const Vertex* vertices, std::size_t vertexCount);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the buffer object and map it if possible
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move to the next region of the ring
+    ///
+    /// With a persistent mapping, a fence is inserted after the
+    /// commands reading from the current region, and we wait for
+    /// the fence of the next region to be signaled before handing
+    /// it out. Otherwise, the buffer is orphaned when wrapping around.
+    ///
+    ////////////////////////////////////////////////////////////
+    void nextRegion();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t RegionCount{3};                        // NOLINT(readability-identifier-naming)
+    static constexpr std::size_t RegionSize{65536};                     // NOLINT(readability-identifier-naming)
+    static constexpr std::size_t VertexCount{RegionCount * RegionSize}; // NOLINT(readability-identifier-naming)
+
+    unsigned int                          m_buffer{};  //!< Internal buffer identifier
+    Vertex*                               m_mapping{}; //!< Persistent mapping of the buffer, if supported
+    std::size_t                           m_region{};  //!< Index of the region currently written to
+    std::size_t                           m_offset{};  //!< Number of vertices already written to the current region
+    std::array<GLEXT_GLsync, RegionCount> m_fences{};  //!< Fences guarding each region (persistent mapping only)
+};
+
+} // namespace priv
+
+} // namespace sf
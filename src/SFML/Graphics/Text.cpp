@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
@@ -62,9 +63,13 @@ void addLine(sf::VertexArray& vertices,
 }
 
 // Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+void addGlyphQuad(sf::VertexArray& vertices,
+                  sf::Vector2f     position,
+                  const sf::Color& color,
+                  const sf::Glyph& glyph,
+                  float            italicShear,
+                  float            padding = 1.f)
 {
-    const float padding = 1.0;
 
     const float left   = glyph.bounds.left - padding;
     const float top    = glyph.bounds.top - padding;
@@ -90,6 +95,56 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Co
                                color,
                                sf::Vector2f(u2, v2)));
 }
+
+// Check whether texts using a font must be drawn from its distance field glyphs
+bool useDistanceField(const sf::Font& font)
+{
+    return font.isDistanceFieldEnabled() && sf::Shader::isAvailable();
+}
+
+// Get the scale to apply to distance field glyphs to draw them at a character size
+float getDistanceFieldScale(unsigned int characterSize)
+{
+    return static_cast<float>(characterSize) / static_cast<float>(sf::Font::DistanceFieldCharacterSize);
+}
+
+// Retrieve a glyph at a character size, scaling the distance field glyph if used
+sf::Glyph getGlyph(const sf::Font& font,
+                   std::uint32_t   codePoint,
+                   unsigned int    characterSize,
+                   bool            bold,
+                   bool            distanceField)
+{
+    if (!distanceField)
+        return font.getGlyph(codePoint, characterSize, bold);
+
+    sf::Glyph   glyph = font.getDistanceFieldGlyph(codePoint, bold);
+    const float scale = getDistanceFieldScale(characterSize);
+    glyph.advance *= scale;
+    glyph.bounds = sf::FloatRect(glyph.bounds.getPosition() * scale, glyph.bounds.getSize() * scale);
+    return glyph;
+}
+
+// Get the kerning offset of two glyphs at a character size, scaling the distance field one if used
+float getKerning(const sf::Font& font,
+                 std::uint32_t   first,
+                 std::uint32_t   second,
+                 unsigned int    characterSize,
+                 bool            bold,
+                 bool            distanceField)
+{
+    if (!distanceField)
+        return font.getKerning(first, second, characterSize, bold);
+
+    return font.getKerning(first, second, sf::Font::DistanceFieldCharacterSize, bold) *
+           getDistanceFieldScale(characterSize);
+}
+
+// Retrieve the texture holding the glyphs of a character size
+const sf::Texture& getTexture(const sf::Font& font, unsigned int characterSize, bool distanceField)
+{
+    return distanceField ? font.getDistanceFieldTexture() : font.getTexture(characterSize);
+}
 } // namespace
 
 
@@ -109,6 +164,12 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
+        // Keep the cached glyphs and layout of the unchanged leading characters
+        const std::size_t common = static_cast<std::size_t>(
+            std::mismatch(m_string.begin(), m_string.end(), string.begin(), string.end()).first - m_string.begin());
+        m_layout.resize(std::min(m_layout.size(), common));
+        m_layoutValid = std::min(m_layoutValid, common);
+
         m_string             = string;
         m_geometryNeedUpdate = true;
     }
@@ -120,8 +181,8 @@ void Text::setFont(const Font& font)
 {
     if (m_font != &font)
     {
-        m_font               = &font;
-        m_geometryNeedUpdate = true;
+        m_font = &font;
+        invalidateShaping();
     }
 }
 
@@ -131,8 +192,8 @@ void Text::setCharacterSize(unsigned int size)
 {
     if (m_characterSize != size)
     {
-        m_characterSize      = size;
-        m_geometryNeedUpdate = true;
+        m_characterSize = size;
+        invalidateShaping();
     }
 }
 
@@ -143,7 +204,7 @@ void Text::setLetterSpacing(float spacingFactor)
     if (m_letterSpacingFactor != spacingFactor)
     {
         m_letterSpacingFactor = spacingFactor;
-        m_geometryNeedUpdate  = true;
+        invalidateLayout();
     }
 }
 
@@ -153,8 +214,8 @@ void Text::setLineSpacing(float spacingFactor)
 {
     if (m_lineSpacingFactor != spacingFactor)
     {
-        m_lineSpacingFactor  = spacingFactor;
-        m_geometryNeedUpdate = true;
+        m_lineSpacingFactor = spacingFactor;
+        invalidateLayout();
     }
 }
 
@@ -164,8 +225,13 @@ void Text::setStyle(std::uint32_t style)
 {
     if (m_style != style)
     {
-        m_style              = style;
-        m_geometryNeedUpdate = true;
+        // Only the bold style changes the glyphs
+        if ((m_style & Bold) != (style & Bold))
+            invalidateShaping();
+        else
+            invalidateLayout();
+
+        m_style = style;
     }
 }
 
@@ -178,12 +244,9 @@ void Text::setFillColor(const Color& color)
         m_fillColor = color;
 
         // Change vertex colors directly, no need to update whole geometry
-        // (if geometry is updated anyway, we can skip this step)
-        if (!m_geometryNeedUpdate)
-        {
-            for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
-                m_vertices[i].color = m_fillColor;
-        }
+        // (the vertices kept by an incremental update must be changed as well)
+        for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+            m_vertices[i].color = m_fillColor;
     }
 }
 
@@ -196,12 +259,9 @@ void Text::setOutlineColor(const Color& color)
         m_outlineColor = color;
 
         // Change vertex colors directly, no need to update whole geometry
-        // (if geometry is updated anyway, we can skip this step)
-        if (!m_geometryNeedUpdate)
-        {
-            for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
-                m_outlineVertices[i].color = m_outlineColor;
-        }
+        // (the vertices kept by an incremental update must be changed as well)
+        for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
+            m_outlineVertices[i].color = m_outlineColor;
     }
 }
 
@@ -211,8 +271,8 @@ void Text::setOutlineThickness(float thickness)
 {
     if (thickness != m_outlineThickness)
     {
-        m_outlineThickness   = thickness;
-        m_geometryNeedUpdate = true;
+        m_outlineThickness = thickness;
+        invalidateShaping();
     }
 }
 
@@ -289,7 +349,8 @@ Vector2f Text::findCharacterPos(std::size_t index) const
 
     // Precompute the variables needed by the algorithm
     const bool  isBold          = m_style & Bold;
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    const bool  distanceField   = useDistanceField(*m_font);
+    float       whitespaceWidth = getGlyph(*m_font, U' ', m_characterSize, isBold, distanceField).advance;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
@@ -302,7 +363,7 @@ Vector2f Text::findCharacterPos(std::size_t index) const
         const std::uint32_t curChar = m_string[i];
 
         // Apply the kerning offset
-        position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        position.x += getKerning(*m_font, prevChar, curChar, m_characterSize, isBold, distanceField);
         prevChar = curChar;
 
         // Handle special characters
@@ -321,7 +382,7 @@ Vector2f Text::findCharacterPos(std::size_t index) const
         }
 
         // For regular characters, add the advance offset of the glyph
-        position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance + letterSpacing;
+        position.x += getGlyph(*m_font, curChar, m_characterSize, isBold, distanceField).advance + letterSpacing;
     }
 
     // Transform the position to global coordinates
@@ -354,38 +415,86 @@ void Text::draw(RenderTarget& target, const RenderStates& states) const
 
     RenderStates statesCopy(states);
 
+    const bool distanceField = useDistanceField(*m_font);
+
     statesCopy.transform *= getTransform();
-    statesCopy.texture = &m_font->getTexture(m_characterSize);
+    statesCopy.texture = &getTexture(*m_font, m_characterSize, distanceField);
 
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
+    {
+        if (distanceField && !states.shader)
+        {
+            // Move the edge outwards by the outline thickness, converted to distance field units
+            const float thickness = std::abs(m_outlineThickness) / getDistanceFieldScale(m_characterSize);
+            const float threshold = 0.5f - thickness / (2.f * Font::DistanceFieldSpread);
+            statesCopy.shader     = m_font->getDistanceFieldShader(std::max(threshold, 0.f));
+        }
+
         target.draw(m_outlineVertices, statesCopy);
+    }
+
+    if (distanceField && !states.shader)
+        statesCopy.shader = m_font->getDistanceFieldShader(std::nullopt);
 
     target.draw(m_vertices, statesCopy);
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Text::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::invalidateShaping()
+{
+    m_layout.clear();
+    m_layoutValid        = 0;
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::invalidateLayout()
+{
+    m_layoutValid        = 0;
+    m_geometryNeedUpdate = true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    const bool          distanceField  = useDistanceField(*m_font);
+    const std::uint64_t fontGeneration = m_font->m_generation;
+
+    // Do nothing, if geometry has not changed and the font glyphs have not been replaced
+    if (!m_geometryNeedUpdate && fontGeneration == m_fontGeneration)
         return;
 
-    // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    // The font was reloaded, the cached glyphs can't be trusted anymore;
+    // glyphs added to the font since don't move the ones already cached
+    if (fontGeneration != m_fontGeneration)
+    {
+        m_layout.clear();
+        m_layoutValid = 0;
+    }
 
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
-
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_bounds         = FloatRect();
+        m_fontGeneration = fontGeneration;
         return;
+    }
 
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
@@ -395,116 +504,203 @@ void Text::ensureGeometryUpdate() const
     const float underlineOffset    = m_font->getUnderlinePosition(m_characterSize);
     const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
 
+    // Distance field glyphs are drawn without padding, their bounds include the spread of the field
+    const float glyphPadding = distanceField ? 0.f : 1.f;
+    const float glyphInset = distanceField ? Font::DistanceFieldSpread * getDistanceFieldScale(m_characterSize) : 0.f;
+
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
-    const FloatRect xBounds             = m_font->getGlyph(U'x', m_characterSize, isBold).bounds;
+    const FloatRect xBounds             = getGlyph(*m_font, U'x', m_characterSize, isBold, distanceField).bounds;
     const float     strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
 
     // Precompute the variables needed by the algorithm
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    float       whitespaceWidth = getGlyph(*m_font, U' ', m_characterSize, isBold, distanceField).advance;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
 
-    // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < m_string.getSize(); ++i)
+    // Find the character preceding a position of the string, ignoring \r which isn't laid out
+    const auto previousCharacter = [this](std::size_t index)
     {
-        const std::uint32_t curChar = m_string[i];
+        while ((index > 0) && (m_string[index - 1] == U'\r'))
+            --index;
 
-        // Skip the \r char to avoid weird graphical issues
+        return (index > 0) ? m_string[index - 1] : 0;
+    };
+
+    // Retrieve the glyphs of the characters which are not cached yet
+    for (std::size_t i = m_layout.size(); i < m_string.getSize(); ++i)
+    {
+        const std::uint32_t curChar   = m_string[i];
+        CharacterLayout&    character = m_layout.emplace_back();
+
+        // The \r char is skipped to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
 
-        // Apply the kerning offset
-        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        character.kerning = getKerning(*m_font, previousCharacter(i), curChar, m_characterSize, isBold, distanceField);
 
-        // If we're using the underlined style and there's a new line, draw a line
-        if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
-        {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        // No glyph for whitespace
+        if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            continue;
 
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
-        }
+        character.glyph = getGlyph(*m_font, curChar, m_characterSize, isBold, distanceField);
 
-        // If we're using the strike through style and there's a new line, draw a line across all characters
-        if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
+        // Distance field outlines are drawn from the regular glyph, with a shader moving its edge
+        if (m_outlineThickness != 0)
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
-
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            character.outlineGlyph = distanceField
+                                         ? character.glyph
+                                         : m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
         }
+    }
 
-        prevChar = curChar;
+    // Resume the layout after the last character whose layout is still valid
+    float       x                  = 0.f;
+    auto        y                  = static_cast<float>(m_characterSize);
+    auto        minX               = static_cast<float>(m_characterSize);
+    auto        minY               = static_cast<float>(m_characterSize);
+    float       maxX               = 0.f;
+    float       maxY               = 0.f;
+    std::size_t vertexCount        = 0;
+    std::size_t outlineVertexCount = 0;
+    if (m_layoutValid > 0)
+    {
+        const CharacterLayout& last = m_layout[m_layoutValid - 1];
+
+        x                  = last.position.x;
+        y                  = last.position.y;
+        minX               = last.boundsMin.x;
+        minY               = last.boundsMin.y;
+        maxX               = last.boundsMax.x;
+        maxY               = last.boundsMax.y;
+        vertexCount        = last.vertexCount;
+        outlineVertexCount = last.outlineVertexCount;
+    }
 
-        // Handle special characters
-        if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+    // Drop the geometry of the characters laid out again
+    m_vertices.resize(vertexCount);
+    m_outlineVertices.resize(outlineVertexCount);
+
+    // Create one quad for each character
+    std::uint32_t prevChar = previousCharacter(m_layoutValid);
+    for (std::size_t i = m_layoutValid; i < m_string.getSize(); ++i)
+    {
+        const std::uint32_t curChar   = m_string[i];
+        CharacterLayout&    character = m_layout[i];
+
+        // Skip the \r char to avoid weird graphical issues
+        if (curChar != U'\r')
         {
-            // Update the current bounds (min coordinates)
-            minX = std::min(minX, x);
-            minY = std::min(minY, y);
+            // Apply the kerning offset
+            x += character.kerning;
 
-            switch (curChar)
+            // If we're using the underlined style and there's a new line, draw a line
+            if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                case U' ':
-                    x += whitespaceWidth;
-                    break;
-                case U'\t':
-                    x += whitespaceWidth * 4;
-                    break;
-                case U'\n':
-                    y += lineSpacing;
-                    x = 0;
-                    break;
+                addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+
+                if (m_outlineThickness != 0)
+                {
+                    addLine(m_outlineVertices,
+                            x,
+                            y,
+                            m_outlineColor,
+                            underlineOffset,
+                            underlineThickness,
+                            m_outlineThickness);
+                }
             }
 
-            // Update the current bounds (max coordinates)
-            maxX = std::max(maxX, x);
-            maxY = std::max(maxY, y);
-
-            // Next glyph, no need to create a quad for whitespace
-            continue;
-        }
+            // If we're using the strike through style and there's a new line, draw a line across all characters
+            if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
+            {
+                addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+
+                if (m_outlineThickness != 0)
+                {
+                    addLine(m_outlineVertices,
+                            x,
+                            y,
+                            m_outlineColor,
+                            strikeThroughOffset,
+                            underlineThickness,
+                            m_outlineThickness);
+                }
+            }
 
-        // Apply the outline
-        if (m_outlineThickness != 0)
-        {
-            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
+            prevChar = curChar;
 
-            // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            // Handle special characters
+            if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            {
+                // Update the current bounds (min coordinates)
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+
+                switch (curChar)
+                {
+                    case U' ':
+                        x += whitespaceWidth;
+                        break;
+                    case U'\t':
+                        x += whitespaceWidth * 4;
+                        break;
+                    case U'\n':
+                        y += lineSpacing;
+                        x = 0;
+                        break;
+                }
+
+                // Update the current bounds (max coordinates)
+                maxX = std::max(maxX, x);
+                maxY = std::max(maxY, y);
+            }
+            else
+            {
+                const Glyph& glyph = character.glyph;
+
+                // Add the outline glyph to the vertices
+                if (m_outlineThickness != 0)
+                {
+                    addGlyphQuad(m_outlineVertices,
+                                 Vector2f(x, y),
+                                 m_outlineColor,
+                                 character.outlineGlyph,
+                                 italicShear,
+                                 glyphPadding);
+                }
+
+                // Add the glyph to the vertices
+                addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear, glyphPadding);
+
+                // Update the current bounds
+                const float left   = glyph.bounds.left + glyphInset;
+                const float top    = glyph.bounds.top + glyphInset;
+                const float right  = glyph.bounds.left + glyph.bounds.width - glyphInset;
+                const float bottom = glyph.bounds.top + glyph.bounds.height - glyphInset;
+
+                minX = std::min(minX, x + left - italicShear * bottom);
+                maxX = std::max(maxX, x + right - italicShear * top);
+                minY = std::min(minY, y + top);
+                maxY = std::max(maxY, y + bottom);
+
+                // Advance to the next character
+                x += glyph.advance + letterSpacing;
+            }
         }
 
-        // Extract the current glyph's description
-        const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
-
-        // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
-
-        // Update the current bounds
-        const float left   = glyph.bounds.left;
-        const float top    = glyph.bounds.top;
-        const float right  = glyph.bounds.left + glyph.bounds.width;
-        const float bottom = glyph.bounds.top + glyph.bounds.height;
-
-        minX = std::min(minX, x + left - italicShear * bottom);
-        maxX = std::max(maxX, x + right - italicShear * top);
-        minY = std::min(minY, y + top);
-        maxY = std::max(maxY, y + bottom);
-
-        // Advance to the next character
-        x += glyph.advance + letterSpacing;
+        // Save the state of the layout, to resume from this character on the next update
+        character.position           = Vector2f(x, y);
+        character.boundsMin          = Vector2f(minX, minY);
+        character.boundsMax          = Vector2f(maxX, maxY);
+        character.vertexCount        = m_vertices.getVertexCount();
+        character.outlineVertexCount = m_outlineVertices.getVertexCount();
     }
 
+    m_layoutValid = m_string.getSize();
+
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
     {
@@ -538,6 +734,9 @@ void Text::ensureGeometryUpdate() const
     m_bounds.top    = minY;
     m_bounds.width  = maxX - minX;
     m_bounds.height = maxY - minY;
+
+    // Save the generation of the glyphs the geometry was built from
+    m_fontGeneration = fontGeneration;
 }
 
 } // namespace sf
@@ -25,20 +25,28 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureUploader.hpp>
 
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/Window.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <atomic>
+#include <memory>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <climits>
@@ -114,7 +122,8 @@ m_isSmooth(std::exchange(right.m_isSmooth, false)),
 m_sRgb(std::exchange(right.m_sRgb, false)),
 m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
-m_cacheId(std::exchange(right.m_cacheId, 0))
+m_cacheId(std::exchange(right.m_cacheId, 0)),
+m_uploader(std::move(right.m_uploader))
 {
 }
 
@@ -145,6 +154,7 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_isRepeated    = std::exchange(right.m_isRepeated, false);
     m_fboAttachment = std::exchange(right.m_fboAttachment, false);
     m_cacheId       = std::exchange(right.m_cacheId, 0);
+    m_uploader      = std::move(right.m_uploader);
     return *this;
 }
 
@@ -269,6 +279,36 @@ bool Texture::loadFromFile(const std::filesystem::path& filename, const IntRect&
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Texture::loadFromFiles(const std::vector<std::filesystem::path>& filenames,
+                                   std::vector<Texture>&                     textures,
+                                   unsigned int                              threadCount)
+{
+    textures.clear();
+    textures.resize(filenames.size());
+
+    // Decode all the files in parallel first
+    std::vector<Image> images;
+    if (Image::loadFromFiles(filenames, images, threadCount) == 0)
+        return 0;
+
+    // Then upload everything at once, activating a context only for the whole pass
+    const TransientContextLock lock;
+
+    std::size_t loadedCount = 0;
+    for (std::size_t i = 0; i < images.size(); ++i)
+    {
+        if ((images[i].getSize().x > 0) && (images[i].getSize().y > 0) && textures[i].loadFromImage(images[i]))
+            ++loadedCount;
+
+        // Release the decoded pixels as soon as they are on the graphics card
+        images[i] = Image();
+    }
+
+    return loadedCount;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromMemory(const void* data, std::size_t size, const IntRect& area)
 {
@@ -356,6 +396,100 @@ bool Texture::loadFromImage(const Image& image, const IntRect& area)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedFile(const std::filesystem::path& filename)
+{
+    // The blocks are uploaded straight from the mapped file
+    MappedFileInputStream file;
+    if (!file.open(filename))
+    {
+        err() << "Failed to load compressed image\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return loadFromCompressedMemory(file.getData(), static_cast<std::size_t>(file.getSize()));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedMemory(const void* data, std::size_t size)
+{
+    if (!data || (size == 0))
+    {
+        err() << "Failed to load compressed image, no data provided" << std::endl;
+        return false;
+    }
+
+    priv::CompressedImage image;
+    if (!priv::parseCompressedImage(static_cast<const std::uint8_t*>(data), size, image))
+        return false;
+
+    {
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        // Upload the blocks as is if the graphics card can sample them and no padding is needed
+        if (priv::isCompressedFormatSupported(image.format) && (getValidSize(image.size.x) == image.size.x) &&
+            (getValidSize(image.size.y) == image.size.y))
+        {
+            if (!create(image.size))
+                return false;
+
+            // Make sure that the current texture binding will be preserved
+            const priv::TextureSaver save;
+
+            // Replace the storage allocated by create with the compressed blocks
+            glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+            glCheck(GLEXT_glCompressedTexImage2D(GL_TEXTURE_2D,
+                                                 0,
+                                                 priv::getCompressedInternalFormat(image.format, m_sRgb),
+                                                 static_cast<GLsizei>(image.size.x),
+                                                 static_cast<GLsizei>(image.size.y),
+                                                 0,
+                                                 static_cast<GLsizei>(image.blocksSize),
+                                                 image.blocks));
+
+            // Force an OpenGL flush, so that the texture will appear updated
+            // in all contexts immediately (solves problems in multi-threaded apps)
+            glCheck(glFlush());
+
+            return true;
+        }
+    }
+
+    // Decompress the image on the CPU as a fallback
+    std::vector<std::uint8_t> pixels;
+    priv::decompressImage(image, pixels);
+
+    Image decompressed;
+    decompressed.create(image.size, pixels.data());
+    return loadFromImage(decompressed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedStream(InputStream& stream)
+{
+    const std::int64_t size = stream.getSize();
+    if (size <= 0)
+    {
+        err() << "Failed to load compressed image, stream is empty" << std::endl;
+        return false;
+    }
+
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(size));
+    if ((stream.seek(0) == -1) || (stream.read(buffer.data(), size) != size))
+    {
+        err() << "Failed to load compressed image, error reading from stream" << std::endl;
+        return false;
+    }
+
+    return loadFromCompressedMemory(buffer.data(), buffer.size());
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -467,6 +601,13 @@ Image Texture::copyToImage() const
 }
 
 
+////////////////////////////////////////////////////////////
+TextureReadback Texture::copyToImageAsync() const
+{
+    return TextureReadback(*this);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels)
 {
@@ -511,6 +652,73 @@ void Texture::update(const std::uint8_t* pixels, const Vector2u& size, const Vec
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::updateAsync(const std::uint8_t* pixels)
+{
+    // Update the whole texture
+    updateAsync(pixels, m_size, {0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::updateAsync(const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    // Fall back to a regular update if pixel buffers are not supported
+    if (!priv::TextureUploader::isAvailable())
+    {
+        update(pixels, size, dest);
+        return;
+    }
+
+    if (pixels && m_texture)
+    {
+        const TransientContextLock lock;
+
+        if (!m_uploader)
+            m_uploader = std::make_unique<priv::TextureUploader>();
+
+        // Stage the pixels and copy them to the texture without waiting for the transfer
+        m_uploader->upload(m_texture, pixels, size, dest);
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        m_hasMipmap     = false;
+        m_pixelsFlipped = false;
+        m_cacheId       = TextureImpl::getUniqueId();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isUpdateComplete() const
+{
+    if (!m_uploader)
+        return true;
+
+    const TransientContextLock lock;
+
+    return m_uploader->isComplete();
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::waitForUpdate() const
+{
+    if (!m_uploader)
+        return;
+
+    const TransientContextLock lock;
+
+    m_uploader->wait();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const Texture& texture)
 {
@@ -941,6 +1149,7 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_uploader, right.m_uploader);
 
     m_cacheId       = TextureImpl::getUniqueId();
     right.m_cacheId = TextureImpl::getUniqueId();
@@ -0,0 +1,372 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureAtlas::Page
+{
+    explicit Page(priv::SkylinePacker thePacker) : packer(std::move(thePacker))
+    {
+    }
+
+    priv::SkylinePacker packer;  //!< Packer keeping track of the free space of the page
+    Texture             texture; //!< Texture containing the pixels of the images
+};
+
+
+////////////////////////////////////////////////////////////
+struct TextureAtlas::Allocation
+{
+    std::size_t         page{};   //!< Index of the page, equal to the number of pages if a new one is needed
+    Vector2u            position; //!< Position of the rectangle in the page
+    priv::SkylinePacker packer;   //!< Packer of the page once the rectangle is placed
+};
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(const Vector2u& pageSize, unsigned int padding) : m_pageSize(pageSize), m_padding(padding)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> TextureAtlas::add(const Image& image)
+{
+    const Vector2u imageSize = image.getSize();
+    if ((imageSize.x == 0) || (imageSize.y == 0))
+    {
+        err() << "Failed to add image to texture atlas: the image is empty" << std::endl;
+        return std::nullopt;
+    }
+
+    // Find a place for the image and its padding
+    std::optional<Allocation> allocation = allocate(m_pages, imageSize + Vector2u(2 * m_padding, 2 * m_padding));
+    if (!allocation)
+    {
+        err() << "Failed to add image to texture atlas: the maximum texture size has been reached" << std::endl;
+        return std::nullopt;
+    }
+
+    // Only take the space once the texture of the page is big enough, so that nothing changes on failure
+    std::unique_ptr<Page> newPage;
+    Page*                 page = nullptr;
+    if (allocation->page < m_pages.size())
+    {
+        page = m_pages[allocation->page].get();
+    }
+    else
+    {
+        newPage = std::make_unique<Page>(allocation->packer);
+        page    = newPage.get();
+    }
+
+    if (!resizeTexture(*page, allocation->packer.getSize()))
+        return std::nullopt;
+
+    page->packer = std::move(allocation->packer);
+    if (newPage)
+        m_pages.push_back(std::move(newPage));
+
+    // Copy the pixels of the image inside the padding
+    const Vector2u imagePosition = allocation->position + Vector2u(m_padding, m_padding);
+    page->texture.update(image, imagePosition);
+
+    m_entries.push_back({allocation->page, IntRect(Vector2i(imagePosition), Vector2i(imageSize))});
+    return m_entries.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::remove(std::size_t id)
+{
+    if (contains(id))
+        m_entries[id].removed = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::contains(std::size_t id) const
+{
+    return (id < m_entries.size()) && !m_entries[id].removed;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t id) const
+{
+    assert(contains(id) && "TextureAtlas::getTexture() The image is not in the atlas");
+    return m_pages[m_entries[id].page]->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TextureAtlas::getTextureRect(std::size_t id) const
+{
+    assert(contains(id) && "TextureAtlas::getTextureRect() The image is not in the atlas");
+    return m_entries[id].rect;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::repack()
+{
+    // Download the current pages, the images are copied from them
+    std::vector<Image> sources;
+    sources.reserve(m_pages.size());
+    for (const auto& page : m_pages)
+        sources.push_back(page->texture.copyToImage());
+
+    // Place the images again, from the tallest to the shortest
+    std::vector<std::size_t> ids;
+    for (std::size_t id = 0; id < m_entries.size(); ++id)
+    {
+        if (!m_entries[id].removed)
+            ids.push_back(id);
+    }
+
+    std::stable_sort(ids.begin(),
+                     ids.end(),
+                     [this](std::size_t left, std::size_t right)
+                     { return m_entries[left].rect.height > m_entries[right].rect.height; });
+
+    std::vector<std::unique_ptr<Page>> pages;
+    std::vector<Entry>                 entries = m_entries;
+    for (const std::size_t id : ids)
+    {
+        Entry&         entry = entries[id];
+        const Vector2u size(static_cast<unsigned int>(entry.rect.width) + 2 * m_padding,
+                            static_cast<unsigned int>(entry.rect.height) + 2 * m_padding);
+
+        std::optional<Allocation> allocation = allocate(pages, size);
+        if (!allocation)
+        {
+            err() << "Failed to repack texture atlas: the maximum texture size has been reached" << std::endl;
+            return false;
+        }
+
+        if (allocation->page < pages.size())
+            pages[allocation->page]->packer = std::move(allocation->packer);
+        else
+            pages.push_back(std::make_unique<Page>(std::move(allocation->packer)));
+
+        entry.page      = allocation->page;
+        entry.rect.left = static_cast<int>(allocation->position.x + m_padding);
+        entry.rect.top  = static_cast<int>(allocation->position.y + m_padding);
+    }
+
+    // Build the new pages; the pages which are no longer needed are kept, because
+    // sprites may still use their texture, but emptied and shrunk to the initial size
+    const std::size_t  pageCount = std::max(pages.size(), m_pages.size());
+    std::vector<Image> images(pageCount);
+    for (std::size_t i = 0; i < pageCount; ++i)
+        images[i].create(i < pages.size() ? pages[i]->packer.getSize() : m_pageSize, Color::Transparent);
+
+    for (const std::size_t id : ids)
+    {
+        const Entry& source      = m_entries[id];
+        const Entry& destination = entries[id];
+
+        if (!images[destination.page].copy(sources[source.page], Vector2u(destination.rect.getPosition()), source.rect))
+        {
+            err() << "Failed to repack texture atlas: the image couldn't be copied" << std::endl;
+            return false;
+        }
+    }
+
+    // Upload them to new textures, leaving the atlas untouched if any of them fails
+    std::vector<Texture> textures(pageCount);
+    for (std::size_t i = 0; i < pageCount; ++i)
+    {
+        if (!textures[i].loadFromImage(images[i]))
+        {
+            err() << "Failed to repack texture atlas: the page texture couldn't be created" << std::endl;
+            return false;
+        }
+
+        textures[i].setSmooth(m_isSmooth);
+    }
+
+    // Everything succeeded, swap the textures so that the texture instances used by the sprites remain the same
+    for (std::size_t i = 0; i < pageCount; ++i)
+    {
+        if (i >= m_pages.size())
+            m_pages.push_back(std::move(pages[i]));
+        else if (i < pages.size())
+            m_pages[i]->packer = std::move(pages[i]->packer);
+        else
+            m_pages[i]->packer = priv::SkylinePacker(m_pageSize);
+
+        m_pages[i]->texture.swap(textures[i]);
+    }
+
+    m_entries = std::move(entries);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::clear()
+{
+    m_pages.clear();
+    m_entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getPageTexture(std::size_t index) const
+{
+    assert(index < m_pages.size() && "TextureAtlas::getPageTexture() Index is out of bounds");
+    return m_pages[index]->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (const auto& page : m_pages)
+        page->texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Allocation> TextureAtlas::allocate(const std::vector<std::unique_ptr<Page>>& pages,
+                                                               const Vector2u&                           size) const
+{
+    const unsigned int maximumSize = Texture::getMaximumSize();
+    if ((size.x > maximumSize) || (size.y > maximumSize))
+        return std::nullopt;
+
+    // Look for free space in the existing pages
+    for (std::size_t i = 0; i < pages.size(); ++i)
+    {
+        priv::SkylinePacker packer = pages[i]->packer;
+        if (const std::optional<Vector2u> position = packer.insert(size))
+            return Allocation{i, *position, std::move(packer)};
+    }
+
+    // Not enough space: make a page 2 times bigger if that's enough
+    for (std::size_t i = 0; i < pages.size(); ++i)
+    {
+        priv::SkylinePacker packer = pages[i]->packer;
+        while ((packer.getSize().x * 2 <= maximumSize) && (packer.getSize().y * 2 <= maximumSize))
+        {
+            packer.grow(packer.getSize() * 2u);
+
+            if (const std::optional<Vector2u> position = packer.insert(size))
+                return Allocation{i, *position, std::move(packer)};
+        }
+    }
+
+    // Still no space: create a new page big enough for the rectangle
+    Vector2u pageSize = m_pageSize;
+    while ((pageSize.x < size.x) || (pageSize.y < size.y))
+        pageSize *= 2u;
+
+    pageSize.x = std::min(pageSize.x, maximumSize);
+    pageSize.y = std::min(pageSize.y, maximumSize);
+
+    priv::SkylinePacker packer(pageSize);
+    if (const std::optional<Vector2u> position = packer.insert(size))
+        return Allocation{pages.size(), *position, std::move(packer)};
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::resizeTexture(Page& page, const Vector2u& size) const
+{
+    if (page.texture.getSize() == size)
+        return true;
+
+    // Create a transparent texture, so that the padding around the images is transparent too
+    Image image;
+    image.create(size, Color::Transparent);
+
+    Texture texture;
+    if (!texture.loadFromImage(image))
+    {
+        err() << "Failed to create texture atlas page" << std::endl;
+        return false;
+    }
+
+    texture.setSmooth(m_isSmooth);
+
+    // Keep the images already placed, and the texture instance used by the sprites
+    if (page.texture.getSize() != Vector2u())
+        texture.update(page.texture);
+
+    page.texture.swap(texture);
+    return true;
+}
+
+} // namespace sf
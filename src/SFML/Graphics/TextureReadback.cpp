@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureUploader.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureReadback::PixelBuffer
+{
+    PixelBuffer() = default;
+
+    ~PixelBuffer()
+    {
+        const TransientContextLock lock;
+
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(fence));
+
+        if (buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+    }
+
+    PixelBuffer(const PixelBuffer&)            = delete;
+    PixelBuffer& operator=(const PixelBuffer&) = delete;
+
+    unsigned int buffer{};   //!< Pixel buffer object the texture is downloaded to
+    GLEXT_GLsync fence{};    //!< Fence signaled once the download is complete
+    Vector2u     size;       //!< Public size of the texture
+    Vector2u     actualSize; //!< Actual size of the texture, including padding
+    bool         flipped{};  //!< Are the pixels flipped vertically?
+};
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(const Texture& texture)
+{
+#ifndef SFML_OPENGL_ES
+
+    // Pixel buffer objects are needed to download asynchronously
+    if (texture.m_texture && priv::TextureUploader::isAvailable())
+    {
+        const TransientContextLock lock;
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        auto pixelBuffer        = std::make_unique<PixelBuffer>();
+        pixelBuffer->size       = texture.m_size;
+        pixelBuffer->actualSize = texture.m_actualSize;
+        pixelBuffer->flipped    = texture.m_pixelsFlipped;
+
+        const auto byteCount = static_cast<GLsizeiptrARB>(texture.m_actualSize.x * texture.m_actualSize.y * 4);
+
+        // Queue the copy of the whole texture into the buffer, the data pointer is now an offset into it
+        glCheck(GLEXT_glGenBuffers(1, &pixelBuffer->buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, pixelBuffer->buffer));
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER, byteCount, nullptr, GLEXT_GL_STREAM_READ));
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        // Mark the point after which the pixels are in the buffer, and make sure
+        // the commands are submitted so that the fence can be polled from any context
+        if (GLEXT_sync)
+            glCheck(pixelBuffer->fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        glCheck(glFlush());
+
+        m_pixelBuffer = std::move(pixelBuffer);
+        return;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // Download synchronously if the system can't do it in the background
+    m_image = texture.copyToImage();
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback& TextureReadback::operator=(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (!m_pixelBuffer || !m_pixelBuffer->fence)
+        return true;
+
+    const TransientContextLock lock;
+
+    GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+    glCheck(result = GLEXT_glClientWaitSync(m_pixelBuffer->fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 0));
+
+    return result != GLEXT_GL_TIMEOUT_EXPIRED;
+}
+
+
+////////////////////////////////////////////////////////////
+const Image& TextureReadback::getImage()
+{
+    if (!m_pixelBuffer)
+        return m_image;
+
+#ifndef SFML_OPENGL_ES
+
+    {
+        const TransientContextLock lock;
+
+        // Reading the buffer waits for the download if it isn't complete yet
+        const PixelBuffer&        pixelBuffer = *m_pixelBuffer;
+        std::vector<std::uint8_t> allPixels(std::size_t{pixelBuffer.actualSize.x} * pixelBuffer.actualSize.y * 4);
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, pixelBuffer.buffer));
+        glCheck(GLEXT_glGetBufferSubData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                         0,
+                                         static_cast<GLsizeiptrARB>(allPixels.size()),
+                                         allPixels.data()));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        if ((pixelBuffer.size == pixelBuffer.actualSize) && !pixelBuffer.flipped)
+        {
+            // Texture is not padded nor flipped, we can use the pixels directly
+            m_image.create(pixelBuffer.size, allPixels.data());
+        }
+        else
+        {
+            // Texture is either padded or flipped, copy the useful pixels row by row
+            std::vector<std::uint8_t> pixels(std::size_t{pixelBuffer.size.x} * pixelBuffer.size.y * 4);
+
+            const std::uint8_t* src      = allPixels.data();
+            std::uint8_t*       dst      = pixels.data();
+            auto                srcPitch = static_cast<std::ptrdiff_t>(pixelBuffer.actualSize.x * 4);
+            const std::size_t   dstPitch = std::size_t{pixelBuffer.size.x} * 4;
+
+            // Handle the case where source pixels are flipped vertically
+            if (pixelBuffer.flipped)
+            {
+                src += srcPitch * static_cast<std::ptrdiff_t>(pixelBuffer.size.y - 1);
+                srcPitch = -srcPitch;
+            }
+
+            for (unsigned int i = 0; i < pixelBuffer.size.y; ++i)
+            {
+                std::memcpy(dst, src, dstPitch);
+                src += srcPitch;
+                dst += dstPitch;
+            }
+
+            m_image.create(pixelBuffer.size, pixels.data());
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // The buffer is not needed anymore
+    m_pixelBuffer.reset();
+
+    return m_image;
+}
+
+} // namespace sf
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureUploader.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+TextureUploader::~TextureUploader()
+{
+    if (m_buffers[0])
+    {
+        const TransientContextLock contextLock;
+
+        for (const GLEXT_GLsync fence : m_fences)
+        {
+            if (fence)
+                glCheck(GLEXT_glDeleteSync(fence));
+        }
+
+        glCheck(GLEXT_glDeleteBuffers(static_cast<GLsizei>(BufferCount), m_buffers.data()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploader::isAvailable()
+{
+    static const bool available = []() -> bool
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        sf::priv::ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureUploader::upload(unsigned int          texture,
+                             const std::uint8_t* pixels,
+                             const Vector2u&     size,
+                             const Vector2u&     dest)
+{
+    if (!m_buffers[0])
+        glCheck(GLEXT_glGenBuffers(static_cast<GLsizei>(BufferCount), m_buffers.data()));
+
+    const std::size_t index = m_next;
+    m_next                  = (m_next + 1) % BufferCount;
+
+    const std::size_t byteCount = std::size_t{size.x} * size.y * 4;
+    const auto        glSize    = static_cast<GLsizeiptrARB>(byteCount);
+
+    // Copy the pixels into the buffer; if the GPU may still be reading from it,
+    // orphan its storage so that the driver hands us a fresh one instead of waiting
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, m_buffers[index]));
+    if (checkFence(index, false) && (m_capacities[index] >= byteCount))
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0, glSize, pixels));
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER, glSize, pixels, GLEXT_GL_STREAM_DRAW));
+        m_capacities[index] = byteCount;
+    }
+
+    // Make sure that the current texture binding will be preserved
+    const TextureSaver save;
+
+    // Update the texture from the buffer, the data pointer is now an offset into it
+    glCheck(glBindTexture(GL_TEXTURE_2D, texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(dest.x),
+                            static_cast<GLint>(dest.y),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(size.y),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            nullptr));
+
+    // Unbind the buffer, other uploads read from client memory
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    // Mark the point after which the GPU is done reading from the buffer
+    if (GLEXT_sync)
+    {
+        if (GLEXT_GLsync& fence = m_fences[index])
+            glCheck(GLEXT_glDeleteSync(fence));
+
+        glCheck(m_fences[index] = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploader::isComplete()
+{
+    bool complete = true;
+    for (std::size_t i = 0; i < BufferCount; ++i)
+        complete = checkFence(i, false) && complete;
+
+    return complete;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureUploader::wait()
+{
+    for (std::size_t i = 0; i < BufferCount; ++i)
+        checkFence(i, true);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploader::checkFence(std::size_t index, bool wait)
+{
+    GLEXT_GLsync& fence = m_fences[index];
+
+    // Without fences, there is nothing to track and uploads are considered complete once issued
+    if (!fence)
+        return true;
+
+    // The flush bit makes sure that the fence eventually gets signaled even if nothing else flushes
+    GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+    do
+    {
+        glCheck(result = GLEXT_glClientWaitSync(fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, wait ? 1'000'000 : 0));
+    } while (wait && (result == GLEXT_GL_TIMEOUT_EXPIRED));
+
+    if (result == GLEXT_GL_TIMEOUT_EXPIRED)
+        return false;
+
+    glCheck(GLEXT_glDeleteSync(fence));
+    fence = nullptr;
+
+    return true;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Stage texture uploads through pixel buffer objects
+///
+/// Pixels are copied into one of a few pixel buffer objects
+/// used in turn, and the texture is then updated from that
+/// buffer. The application's memory can be reused as soon as
+/// upload returns, while the actual transfer to the texture
+/// happens asynchronously and overlaps with rendering.
+///
+/// A fence is inserted after each transfer (when supported)
+/// so that its completion can be queried without stalling.
+///
+////////////////////////////////////////////////////////////
+class TextureUploader : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The buffer objects are only created on first use.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureUploader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader(const TextureUploader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader& operator=(const TextureUploader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports pixel buffer objects
+    ///
+    /// \return True if asynchronous uploads are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload pixels to a part of a texture
+    ///
+    /// This function must be called with a context active.
+    ///
+    /// \param texture OpenGL name of the texture to update
+    /// \param pixels  Array of 32-bits RGBA pixels to copy to the texture
+    /// \param size    Width and height of the pixel region contained in \a pixels
+    /// \param dest    Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload(unsigned int texture, const std::uint8_t* pixels, const Vector2u& size, const Vector2u& dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether all the uploads issued so far have completed
+    ///
+    /// \return True if the GPU is done with every pending upload
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isComplete();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the uploads issued so far have completed
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Check the fence guarding a buffer
+    ///
+    /// The fence is released once it has been signaled.
+    ///
+    /// \param index Index of the buffer
+    /// \param wait  True to wait for the fence if it isn't signaled yet
+    ///
+    /// \return True if the GPU is done reading from the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool checkFence(std::size_t index, bool wait);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t BufferCount{3}; // NOLINT(readability-identifier-naming)
+
+    std::array<unsigned int, BufferCount> m_buffers{};    //!< Pixel buffer objects, used in turn
+    std::array<std::size_t, BufferCount>  m_capacities{}; //!< Size of the storage of each buffer, in bytes
+    std::array<GLEXT_GLsync, BufferCount> m_fences{};     //!< Fences signaled when the GPU is done with each buffer
+    std::size_t                           m_next{};       //!< Index of the buffer to use for the next upload
+};
+
+} // namespace sf::priv
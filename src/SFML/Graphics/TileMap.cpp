@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TileMapImpl
+{
+// Get the range of chunks overlapping [begin, end) along one axis
+std::pair<unsigned int, unsigned int> getChunkRange(float begin, float end, float chunkExtent, unsigned int chunkCount)
+{
+    const auto clampIndex = [chunkCount](float index)
+    { return static_cast<unsigned int>(std::clamp(index, 0.f, static_cast<float>(chunkCount))); };
+
+    return {clampIndex(std::floor(begin / chunkExtent)), clampIndex(std::ceil(end / chunkExtent))};
+}
+} // namespace TileMapImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Vector2u& mapSize, const Vector2f& tileSize, const Vector2u& chunkSize) :
+m_mapSize(mapSize),
+m_tileSize(tileSize),
+m_chunkSize(chunkSize),
+m_chunkCount((mapSize.x + chunkSize.x - 1) / chunkSize.x, (mapSize.y + chunkSize.y - 1) / chunkSize.y)
+{
+    assert(tileSize.x > 0.f && tileSize.y > 0.f && "Tile size must be positive");
+    assert(chunkSize.x > 0 && chunkSize.y > 0 && "Chunk size must not be zero");
+
+    m_chunks.resize(std::size_t{m_chunkCount.x} * m_chunkCount.y);
+
+    for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+        {
+            // Chunks on the right and bottom edges may be smaller than the others
+            Chunk& chunk = m_chunks[std::size_t{y} * m_chunkCount.x + x];
+            chunk.size = {std::min(chunkSize.x, mapSize.x - x * chunkSize.x),
+                          std::min(chunkSize.y, mapSize.y - y * chunkSize.y)};
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTexture(const Texture* texture)
+{
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TileMap::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(const Vector2u& position, const IntRect& textureRect, const Color& color)
+{
+    Vertex* vertices = getTileVertices(position);
+
+    const float left   = static_cast<float>(position.x) * m_tileSize.x;
+    const float top    = static_cast<float>(position.y) * m_tileSize.y;
+    const float right  = left + m_tileSize.x;
+    const float bottom = top + m_tileSize.y;
+
+    const auto texLeft   = static_cast<float>(textureRect.left);
+    const auto texTop    = static_cast<float>(textureRect.top);
+    const auto texRight  = static_cast<float>(textureRect.left + textureRect.width);
+    const auto texBottom = static_cast<float>(textureRect.top + textureRect.height);
+
+    // Two triangles per tile
+    vertices[0] = Vertex({left, top}, color, {texLeft, texTop});
+    vertices[1] = Vertex({right, top}, color, {texRight, texTop});
+    vertices[2] = Vertex({left, bottom}, color, {texLeft, texBottom});
+    vertices[3] = Vertex({left, bottom}, color, {texLeft, texBottom});
+    vertices[4] = Vertex({right, top}, color, {texRight, texTop});
+    vertices[5] = Vertex({right, bottom}, color, {texRight, texBottom});
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::removeTile(const Vector2u& position)
+{
+    // Degenerate triangles don't produce any fragment
+    std::fill_n(getTileVertices(position), 6, Vertex());
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    const float width  = static_cast<float>(m_mapSize.x) * m_tileSize.x;
+    const float height = static_cast<float>(m_mapSize.y) * m_tileSize.y;
+
+    return {{0.f, 0.f}, {width, height}};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, const RenderStates& states) const
+{
+    RenderStates statesCopy(states);
+
+    statesCopy.transform *= getTransform();
+    statesCopy.texture = m_texture;
+
+    // Find the chunks which overlap the view, in the local coordinates of the map;
+    // shaders may move vertices anywhere, so every chunk is drawn when one is used
+    std::pair<unsigned int, unsigned int> rangeX(0, m_chunkCount.x);
+    std::pair<unsigned int, unsigned int> rangeY(0, m_chunkCount.y);
+
+    if (!states.shader)
+    {
+        const Transform viewToLocal = statesCopy.transform.getInverse() * target.getView().getInverseTransform();
+        const FloatRect area        = viewToLocal.transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+        const Vector2f  chunkExtent(static_cast<float>(m_chunkSize.x) * m_tileSize.x,
+                                   static_cast<float>(m_chunkSize.y) * m_tileSize.y);
+
+        rangeX = TileMapImpl::getChunkRange(area.left, area.left + area.width, chunkExtent.x, m_chunkCount.x);
+        rangeY = TileMapImpl::getChunkRange(area.top, area.top + area.height, chunkExtent.y, m_chunkCount.y);
+    }
+
+    for (unsigned int y = rangeY.first; y < rangeY.second; ++y)
+    {
+        for (unsigned int x = rangeX.first; x < rangeX.second; ++x)
+        {
+            Chunk& chunk = m_chunks[std::size_t{y} * m_chunkCount.x + x];
+
+            // Skip chunks in which no tile was ever set
+            if (chunk.vertices.empty())
+                continue;
+
+            if (upload(chunk))
+                target.draw(*chunk.buffer, statesCopy);
+            else
+                target.draw(chunk.vertices.data(), chunk.vertices.size(), PrimitiveType::Triangles, statesCopy);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> TileMap::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+Vertex* TileMap::getTileVertices(const Vector2u& position)
+{
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "Tile position is out of the map");
+
+    Chunk& chunk = m_chunks[std::size_t{position.y / m_chunkSize.y} * m_chunkCount.x + position.x / m_chunkSize.x];
+
+    // Chunks are allocated the first time that one of their tiles is set
+    if (chunk.vertices.empty())
+        chunk.vertices.resize(std::size_t{chunk.size.x} * chunk.size.y * 6);
+
+    const std::size_t first = (std::size_t{position.y % m_chunkSize.y} * chunk.size.x + position.x % m_chunkSize.x) * 6;
+
+    // Extend the range of vertices to upload so that it contains the tile
+    if (chunk.dirtyBegin == chunk.dirtyEnd)
+    {
+        chunk.dirtyBegin = first;
+        chunk.dirtyEnd   = first + 6;
+    }
+    else
+    {
+        chunk.dirtyBegin = std::min(chunk.dirtyBegin, first);
+        chunk.dirtyEnd   = std::max(chunk.dirtyEnd, first + 6);
+    }
+
+    return &chunk.vertices[first];
+}
+
+
+////////////////////////////////////////////////////////////
+bool TileMap::upload(Chunk& chunk) const
+{
+    // Once a vertex buffer couldn't be created, draw all the chunks from client memory
+    if (m_buffersUnavailable)
+        return false;
+
+    // Create the buffer and send all the vertices the first time that the chunk is drawn
+    if (!chunk.buffer || chunk.buffer->getVertexCount() != chunk.vertices.size())
+    {
+        if (!chunk.buffer)
+            chunk.buffer.emplace(PrimitiveType::Triangles, VertexBuffer::Static);
+
+        if (!VertexBuffer::isAvailable() || !chunk.buffer->create(chunk.vertices.size()))
+        {
+            m_buffersUnavailable = true;
+            chunk.buffer.reset();
+            return false;
+        }
+
+        chunk.dirtyBegin = 0;
+        chunk.dirtyEnd   = chunk.vertices.size();
+    }
+
+    // Then only send the vertices of the tiles which changed since the last upload
+    if (chunk.dirtyBegin != chunk.dirtyEnd)
+    {
+        if (!chunk.buffer->update(chunk.vertices.data() + chunk.dirtyBegin,
+                                  chunk.dirtyEnd - chunk.dirtyBegin,
+                                  static_cast<unsigned int>(chunk.dirtyBegin)))
+            return false;
+
+        chunk.dirtyBegin = 0;
+        chunk.dirtyEnd   = 0;
+    }
+
+    return true;
+}
+
+} // namespace sf
@@ -145,4 +145,11 @@ void VertexArray::draw(RenderTarget& target, const RenderStates& states) const
         target.draw(m_vertices.data(), m_vertices.size(), m_primitiveType, states);
 }
 
+
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> VertexArray::getCullingBounds() const
+{
+    return getBounds();
+}
+
 } // namespace sf
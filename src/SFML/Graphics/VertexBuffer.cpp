@@ -32,6 +32,7 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <atomic>
 #include <ostream>
 #include <utility>
 
@@ -55,6 +56,15 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+// Thread-safe unique identifier generator,
+// is used for the instance geometry cache (see RenderTarget)
+std::uint64_t getUniqueId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no contents"
+
+    return id.fetch_add(1);
+}
 } // namespace VertexBufferImpl
 } // namespace
 
@@ -139,7 +149,8 @@ bool VertexBuffer::create(std::size_t vertexCount)
                                VertexBufferImpl::usageToGlEnum(m_usage)));
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
-    m_size = vertexCount;
+    m_size    = vertexCount;
+    m_cacheId = VertexBufferImpl::getUniqueId();
 
     return true;
 }
@@ -194,6 +205,8 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
+    m_cacheId = VertexBufferImpl::getUniqueId();
+
     return true;
 }
 
@@ -215,6 +228,8 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     // Make sure that extensions are initialized
     sf::priv::ensureExtensionsInit();
 
+    m_cacheId = VertexBufferImpl::getUniqueId();
+
     if (GLEXT_copy_buffer)
     {
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, vertexBuffer.m_buffer));
@@ -282,6 +297,7 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_cacheId, right.m_cacheId);
 }
 
 
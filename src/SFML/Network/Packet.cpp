@@ -31,6 +31,8 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <utility>
+
 #include <cstring>
 #include <cwchar>
 
@@ -601,7 +603,20 @@ const void* Packet::onSend(std::size_t& size)
 ////////////////////////////////////////////////////////////
 void Packet::onReceive(const void* data, std::size_t size)
 {
-    append(data, size);
+    // Take over the buffer of onReceiveBuffer if the bytes reach us untransformed
+    if (m_receivedBuffer && (data == m_receivedBuffer->data()) && (size == m_receivedBuffer->size()) && m_data.empty())
+        m_data = std::move(*m_receivedBuffer);
+    else
+        append(data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::onReceiveBuffer(std::vector<std::byte>&& data)
+{
+    m_receivedBuffer = &data;
+    onReceive(data.data(), data.size());
+    m_receivedBuffer = nullptr;
 }
 
 } // namespace sf
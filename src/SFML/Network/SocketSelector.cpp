@@ -22,6 +22,7 @@
 //
 ////////////////////////////////////////////////////////////
 
+
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
@@ -34,24 +35,116 @@
 #include <algorithm>
 #include <memory>
 #include <ostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstdint>
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#include <sys/epoll.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
 #endif
 
 
+namespace
+{
+struct SocketEntry
+{
+    sf::Socket*   socket{};          //!< Socket that was added to the selector
+    std::uint32_t watched{};         //!< Readiness flags that the socket is watched for
+    std::uint32_t readiness{};       //!< Readiness flags found by the last wait that reported the socket
+    std::uint64_t readyGeneration{}; //!< Value of the selector's generation when the socket was last found ready
+};
+
+////////////////////////////////////////////////////////////
+// Readiness reported for a socket that has an error pending
+////////////////////////////////////////////////////////////
+std::uint32_t errorReadiness(std::uint32_t watched)
+{
+    // The socket won't block on any operation anymore (it will fail instead),
+    // so it is reported as ready for everything it is watched for
+    return sf::SocketSelector::Error | (watched & (sf::SocketSelector::Receive | sf::SocketSelector::Send));
+}
+} // namespace
+
+
 namespace sf
 {
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+////////////////////////////////////////////////////////////
+struct SocketSelector::SocketSelectorImpl
+{
+    SocketSelectorImpl() : epoll(epoll_create1(EPOLL_CLOEXEC))
+    {
+        if (epoll == -1)
+            err() << "Failed to create the selector's epoll instance: " << std::strerror(errno) << std::endl;
+    }
+
+    SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
+    {
+        // An epoll instance can't be duplicated, register the same handles on our own one
+        for (const auto& [handle, entry] : copy.sockets)
+        {
+            if (registerHandle(handle, entry.watched))
+                sockets.emplace(handle, SocketEntry{entry.socket, entry.watched, 0, 0});
+        }
+    }
+
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    ~SocketSelectorImpl()
+    {
+        if (epoll != -1)
+            ::close(epoll);
+    }
+
+    bool registerHandle(SocketHandle handle, std::uint32_t watched) const
+    {
+        epoll_event event{};
+        event.events  = ((watched & Receive) ? EPOLLIN : 0u) | ((watched & Send) ? EPOLLOUT : 0u);
+        event.data.fd = handle;
+
+        // A closed handle has already been dropped by the kernel, so it is
+        // registered again if its value gets reused by a new socket
+        if (epoll_ctl(epoll, EPOLL_CTL_ADD, handle, &event) == 0)
+            return true;
+
+        return (errno == EEXIST) && (epoll_ctl(epoll, EPOLL_CTL_MOD, handle, &event) == 0);
+    }
+
+    int                                           epoll;         //!< Handle of the epoll instance
+    std::unordered_map<SocketHandle, SocketEntry> sockets;       //!< Sockets stored in the selector, by handle
+    std::vector<epoll_event>                      events;        //!< Buffer receiving the events reported by epoll_wait
+    std::vector<SocketEntry*>                     readySockets;  //!< Sockets found ready by the last wait
+    std::uint64_t                                 generation{1}; //!< Identifier of the last wait
+};
+
+#else
+
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets;   //!< Set containing all the sockets handles
-    fd_set socketsReady; //!< Set containing handles of the sockets that are ready
-    int    maxSocket;    //!< Maximum socket handle
-    int    socketCount;  //!< Number of socket handles
+    fd_set                                        allSockets{};     //!< Set containing all the sockets handles
+    fd_set                                        receiveSockets{}; //!< Set containing the sockets watched for Receive
+    fd_set                                        sendSockets{};    //!< Set containing the sockets watched for Send
+    int                                           maxSocket{};      //!< Maximum socket handle
+    std::unordered_map<SocketHandle, SocketEntry> sockets;          //!< Sockets stored in the selector, by handle
+    std::vector<SocketEntry*>                     readySockets;     //!< Sockets found ready by the last wait
+    std::uint64_t                                 generation{1};    //!< Identifier of the last wait
 };
 
+#endif
+
 
 ////////////////////////////////////////////////////////////
 SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
@@ -67,6 +160,9 @@ SocketSelector::~SocketSelector() = default;
 ////////////////////////////////////////////////////////////
 SocketSelector::SocketSelector(const SocketSelector& copy) : m_impl(std::make_unique<SocketSelectorImpl>(*copy.m_impl))
 {
+    // Readiness is not copied, it belongs to the wait call of the source selector
+    m_impl->readySockets.clear();
+    ++m_impl->generation;
 }
 
 
@@ -88,15 +184,27 @@ SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::add(Socket& socket)
+void SocketSelector::add(Socket& socket, std::uint32_t readiness)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        // Errors are always reported, they don't need to be watched for
+        const std::uint32_t watched = readiness & (Receive | Send);
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+        if (!m_impl->registerHandle(handle, watched))
+        {
+            err() << "The socket can't be added to the selector: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+#else
 
 #if defined(SFML_SYSTEM_WINDOWS)
 
-        if (m_impl->socketCount >= FD_SETSIZE)
+        if (m_impl->sockets.count(handle) == 0 && m_impl->sockets.size() >= FD_SETSIZE)
         {
             err() << "The socket can't be added to the selector because the "
                   << "selector is full. This is a limitation of your operating "
@@ -104,11 +212,6 @@ void SocketSelector::add(Socket& socket)
             return;
         }
 
-        if (FD_ISSET(handle, &m_impl->allSockets))
-            return;
-
-        ++m_impl->socketCount;
-
 #else
 
         if (handle >= FD_SETSIZE)
@@ -125,6 +228,23 @@ void SocketSelector::add(Socket& socket)
 #endif
 
         FD_SET(handle, &m_impl->allSockets);
+
+        if (watched & Receive)
+            FD_SET(handle, &m_impl->receiveSockets);
+        else
+            FD_CLR(handle, &m_impl->receiveSockets);
+
+        if (watched & Send)
+            FD_SET(handle, &m_impl->sendSockets);
+        else
+            FD_CLR(handle, &m_impl->sendSockets);
+
+#endif
+
+        // A handle that is already stored may belong to a new socket if the old one was closed
+        SocketEntry& entry = m_impl->sockets[handle];
+        entry.socket       = &socket;
+        entry.watched      = watched;
     }
 }
 
@@ -135,23 +255,32 @@ void SocketSelector::remove(Socket& socket)
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        const auto it = m_impl->sockets.find(handle);
+        if (it == m_impl->sockets.end())
+            return;
 
-#if defined(SFML_SYSTEM_WINDOWS)
+        // Leave a null entry in the ready list rather than shifting it,
+        // so that callers can remove sockets while visiting it by index
+        if (it->second.readyGeneration == m_impl->generation)
+        {
+            auto& readySockets = m_impl->readySockets;
+            *std::find(readySockets.begin(), readySockets.end(), &it->second) = nullptr;
+        }
 
-        if (!FD_ISSET(handle, &m_impl->allSockets))
-            return;
+        m_impl->sockets.erase(it);
 
-        --m_impl->socketCount;
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+        // Failure only means that the handle was already closed, which unregisters it as well
+        epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, handle, nullptr);
 
 #else
 
-        if (handle >= FD_SETSIZE)
-            return;
+        FD_CLR(handle, &m_impl->allSockets);
+        FD_CLR(handle, &m_impl->receiveSockets);
+        FD_CLR(handle, &m_impl->sendSockets);
 
 #endif
-
-        FD_CLR(handle, &m_impl->allSockets);
-        FD_CLR(handle, &m_impl->socketsReady);
     }
 }
 
@@ -159,51 +288,174 @@ void SocketSelector::remove(Socket& socket)
 ////////////////////////////////////////////////////////////
 void SocketSelector::clear()
 {
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+    for (const auto& [handle, entry] : m_impl->sockets)
+        epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, handle, nullptr);
+
+#else
+
     FD_ZERO(&m_impl->allSockets);
-    FD_ZERO(&m_impl->socketsReady);
+    FD_ZERO(&m_impl->receiveSockets);
+    FD_ZERO(&m_impl->sendSockets);
 
-    m_impl->maxSocket   = 0;
-    m_impl->socketCount = 0;
+    m_impl->maxSocket = 0;
+
+#endif
+
+    m_impl->sockets.clear();
+    m_impl->readySockets.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SocketSelector::wait(Time timeout)
 {
+    // Invalidate the results of the previous call
+    m_impl->readySockets.clear();
+    ++m_impl->generation;
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+    // Round the timeout up to the next millisecond, so that a short timeout doesn't turn into polling
+    int milliseconds = -1;
+    if (timeout != Time::Zero)
+    {
+        const std::int64_t rounded = (timeout.asMicroseconds() + 999) / 1000;
+        milliseconds               = static_cast<int>(std::clamp(rounded, std::int64_t{0}, std::int64_t{INT_MAX}));
+    }
+
+    // Wait until one of the sockets is ready, or timeout is reached
+    // Ready sockets that don't fit in the buffer are reported by the next call
+    auto& events = m_impl->events;
+    events.resize(std::clamp(m_impl->sockets.size(), std::size_t{1}, std::size_t{INT_MAX}));
+    const int count = epoll_wait(m_impl->epoll, events.data(), static_cast<int>(events.size()), milliseconds);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const epoll_event& event = events[static_cast<std::size_t>(i)];
+
+        const auto it = m_impl->sockets.find(event.data.fd);
+        if (it == m_impl->sockets.end())
+            continue;
+
+        SocketEntry& entry = it->second;
+        entry.readiness    = 0;
+
+        if (event.events & EPOLLIN)
+            entry.readiness |= Receive;
+        if (event.events & EPOLLOUT)
+            entry.readiness |= Send;
+        if (event.events & (EPOLLERR | EPOLLHUP))
+            entry.readiness |= errorReadiness(entry.watched);
+
+        entry.readyGeneration = m_impl->generation;
+        m_impl->readySockets.push_back(&entry);
+    }
+
+#else
+
     // Setup the timeout
     timeval time{};
     time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
     time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1000000);
 
-    // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
+    // Initialize the sets that will contain the sockets that are ready
+    fd_set receiveReady = m_impl->receiveSockets;
+    fd_set sendReady    = m_impl->sendSockets;
+
+#if defined(SFML_SYSTEM_WINDOWS)
+
+    // Windows reports failed connections in the exception set rather than as writable
+    fd_set  errorReady    = m_impl->allSockets;
+    fd_set* errorReadyPtr = &errorReady;
+
+#else
+
+    // Elsewhere the exception set is about out-of-band data, errors make the socket readable and writable
+    fd_set* errorReadyPtr = nullptr;
 
-    // Wait until one of the sockets is ready for reading, or timeout is reached
+#endif
+
+    // Wait until one of the sockets is ready, or timeout is reached
     // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
+    const int count = select(m_impl->maxSocket + 1,
+                             &receiveReady,
+                             &sendReady,
+                             errorReadyPtr,
+                             timeout != Time::Zero ? &time : nullptr);
+
+    if (count > 0)
+    {
+        for (auto& [handle, entry] : m_impl->sockets)
+        {
+            entry.readiness = 0;
+
+            if (FD_ISSET(handle, &receiveReady))
+                entry.readiness |= Receive;
+            if (FD_ISSET(handle, &sendReady))
+                entry.readiness |= Send;
+            if (errorReadyPtr && FD_ISSET(handle, errorReadyPtr))
+                entry.readiness |= errorReadiness(entry.watched);
+
+            if (entry.readiness != 0)
+            {
+                entry.readyGeneration = m_impl->generation;
+                m_impl->readySockets.push_back(&entry);
+            }
+        }
+    }
+
+#endif
 
-    return count > 0;
+    return !m_impl->readySockets.empty();
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SocketSelector::isReady(Socket& socket) const
+{
+    return isReady(socket, Receive);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReady(Socket& socket, std::uint32_t readiness) const
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        const auto it = m_impl->sockets.find(handle);
+        if ((it != m_impl->sockets.end()) && (it->second.readyGeneration == m_impl->generation))
+            return (it->second.readiness & readiness) != 0;
+    }
 
-#if !defined(SFML_SYSTEM_WINDOWS)
+    return false;
+}
 
-        if (handle >= FD_SETSIZE)
-            return false;
 
-#endif
+////////////////////////////////////////////////////////////
+std::size_t SocketSelector::getReadyCount() const
+{
+    return m_impl->readySockets.size();
+}
 
-        return FD_ISSET(handle, &m_impl->socketsReady) != 0;
-    }
 
-    return false;
+////////////////////////////////////////////////////////////
+Socket* SocketSelector::getReadySocket(std::size_t index) const
+{
+    assert(index < m_impl->readySockets.size() && "Index is out of bounds");
+    const SocketEntry* entry = m_impl->readySockets[index];
+    return entry ? entry->socket : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t SocketSelector::getReadiness(std::size_t index) const
+{
+    assert(index < m_impl->readySockets.size() && "Index is out of bounds");
+    const SocketEntry* entry = m_impl->readySockets[index];
+    return entry ? entry->readiness : 0;
 }
 
 } // namespace sf
@@ -122,8 +122,8 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     if (remote == priv::SocketImpl::invalidSocket())
         return priv::SocketImpl::getErrorStatus();
 
-    // Initialize the new connected socket
-    socket.close();
+    // Initialize the new connected socket, discarding what was left from its previous connection
+    socket.disconnect();
     socket.create(remote);
 
     return Status::Done;
@@ -33,7 +33,9 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <array>
 #include <ostream>
+#include <utility>
 
 #include <cstring>
 
@@ -50,6 +52,12 @@ const int flags = MSG_NOSIGNAL;
 #else
 const int flags = 0;
 #endif
+
+// Maximum number of packets gathered into a single vectored send
+constexpr std::size_t maxPacketsPerSend = 64;
+
+// Number of bytes requested from the system at once when received data is buffered
+constexpr std::size_t receiveBufferSize = 64 * 1024;
 } // namespace
 
 namespace sf
@@ -218,6 +226,22 @@ void TcpSocket::disconnect()
 
     // Reset the pending packet data
     m_pendingPacket = PendingPacket();
+    m_receiveBuffer = ReceiveBuffer();
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::setReceiveBuffered(bool buffered)
+{
+    // Bytes that are already buffered are still returned by the next calls to receive
+    m_receiveBuffered = buffered;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::isReceiveBuffered() const
+{
+    return m_receiveBuffered;
 }
 
 
@@ -285,17 +309,48 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         return Status::Error;
     }
 
+    // Return the bytes that were buffered by a previous call first
+    ReceiveBuffer& buffer = m_receiveBuffer;
+    if (buffer.Begin < buffer.End)
+    {
+        received = std::min(size, buffer.End - buffer.Begin);
+        std::memcpy(data, buffer.Data.data() + buffer.Begin, received);
+        buffer.Begin += received;
+        return Status::Done;
+    }
+
+    // When buffering, receive as much as the system has and keep what wasn't requested
+    const bool useBuffer = m_receiveBuffered && (size < receiveBufferSize);
+    if (useBuffer)
+    {
+        buffer.Data.resize(receiveBufferSize);
+        buffer.Begin = 0;
+        buffer.End   = 0;
+    }
+
+    char*             destination = useBuffer ? reinterpret_cast<char*>(buffer.Data.data()) : static_cast<char*>(data);
+    const std::size_t capacity    = useBuffer ? buffer.Data.size() : size;
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
     // Receive a chunk of bytes
     const int sizeReceived = static_cast<int>(
-        recv(getNativeHandle(), static_cast<char*>(data), static_cast<priv::SocketImpl::Size>(size), flags));
+        recv(getNativeHandle(), destination, static_cast<priv::SocketImpl::Size>(capacity), flags));
 #pragma GCC diagnostic pop
 
     // Check the number of bytes received
     if (sizeReceived > 0)
     {
         received = static_cast<std::size_t>(sizeReceived);
+
+        if (useBuffer)
+        {
+            buffer.End = received;
+            received   = std::min(size, buffer.End);
+            std::memcpy(data, buffer.Data.data(), received);
+            buffer.Begin = received;
+        }
+
         return Status::Done;
     }
     else if (sizeReceived == 0)
@@ -311,57 +366,116 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(Packet& packet)
+{
+    return send(&packet, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(Packet* packets, std::size_t count)
 {
     // TCP is a stream protocol, it doesn't preserve messages boundaries.
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+    // The size and the data of each packet are gathered from where they
+    // are with vectored I/O, so that they are sent together without being
+    // copied into a single block. Sending them in separate calls could
+    // cause a partial send, and thus data corruption on the receiving end.
 
-    // Get the data to send from the packet
-    std::size_t size = 0;
-    const void* data = packet.onSend(size);
+    // Each packet records how many of its bytes (size included) were sent,
+    // so that a partial send can be resumed. A packet that was entirely sent
+    // keeps its full length until the whole array is done.
+    struct PacketToSend
+    {
+        Packet*       packet; //!< Packet being sent
+        const void*   data;   //!< Data to send, as returned by Packet::onSend
+        std::size_t   size;   //!< Size of the data to send
+        std::uint32_t header; //!< Size of the data in network byte order
+    };
+
+    std::array<PacketToSend, maxPacketsPerSend>                 toSend;
+    std::array<priv::SocketImpl::Buffer, maxPacketsPerSend * 2> buffers;
+
+    Status      status = Status::Done;
+    std::size_t next   = 0;
+    while (status == Status::Done)
+    {
+        // Gather the next packets that still have data to send
+        std::size_t gathered = 0;
+        for (; (next < count) && (gathered < toSend.size()); ++next)
+        {
+            Packet&     packet = packets[next];
+            std::size_t size   = 0;
+            const void* data   = packet.onSend(size);
 
-    // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+            if (packet.m_sendPos < sizeof(std::uint32_t) + size)
+                toSend[gathered++] = {&packet, data, size, htonl(static_cast<std::uint32_t>(size))};
+        }
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+        if (gathered == 0)
+            break;
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+        // Send them until they are all gone or the socket can't take more
+        std::size_t first = 0;
+        while ((first < gathered) && (status == Status::Done))
+        {
+            std::size_t bufferCount = 0;
+            for (std::size_t i = first; i < gathered; ++i)
+            {
+                const PacketToSend& packet = toSend[i];
+                const std::size_t   offset = packet.packet->m_sendPos;
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+                if (offset < sizeof(packet.header))
+                {
+                    const char* header     = reinterpret_cast<const char*>(&packet.header) + offset;
+                    buffers[bufferCount++] = priv::SocketImpl::createBuffer(header, sizeof(packet.header) - offset);
+                }
+
+                const std::size_t dataOffset = offset - std::min(offset, sizeof(packet.header));
+                if (dataOffset < packet.size)
+                {
+                    const char* data       = static_cast<const char*>(packet.data) + dataOffset;
+                    buffers[bufferCount++] = priv::SocketImpl::createBuffer(data, packet.size - dataOffset);
+                }
+            }
+
+            std::size_t sent = 0;
+            status           = priv::SocketImpl::sendBuffers(getNativeHandle(), buffers.data(), bufferCount, sent);
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
+            // Record the progress of each packet covered by the bytes that were sent
+            while (sent > 0)
+            {
+                Packet&           packet    = *toSend[first].packet;
+                const std::size_t remaining = sizeof(std::uint32_t) + toSend[first].size - packet.m_sendPos;
+                const std::size_t progress  = std::min(sent, remaining);
+
+                packet.m_sendPos += progress;
+                sent -= progress;
+
+                if (progress == remaining)
+                    ++first;
+            }
+        }
+    }
+
+    if (status == Status::Done)
     {
-        packet.m_sendPos += sent;
+        // Everything was sent, the packets can be sent again from the beginning
+        for (std::size_t i = 0; i < count; ++i)
+            packets[i].m_sendPos = 0;
+
+        return Status::Done;
     }
-    else if (status == Status::Done)
+
+    // If some data was sent, the remaining data must be sent before anything else
+    if (status == Status::NotReady)
     {
-        packet.m_sendPos = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (packets[i].m_sendPos > 0)
+                return Status::Partial;
+        }
     }
 
     return status;
@@ -375,53 +489,52 @@ Socket::Status TcpSocket::receive(Packet& packet)
     packet.clear();
 
     // We start by getting the size of the incoming packet
-    std::uint32_t packetSize = 0;
-    std::size_t   received   = 0;
-    if (m_pendingPacket.SizeReceived < sizeof(m_pendingPacket.Size))
+    // (even a 4 byte variable may be received in more than one call)
+    std::size_t received = 0;
+    while (m_pendingPacket.SizeReceived < sizeof(m_pendingPacket.Size))
     {
-        // Loop until we've received the entire size of the packet
-        // (even a 4 byte variable may be received in more than one call)
-        while (m_pendingPacket.SizeReceived < sizeof(m_pendingPacket.Size))
-        {
-            char*        data   = reinterpret_cast<char*>(&m_pendingPacket.Size) + m_pendingPacket.SizeReceived;
-            const Status status = receive(data, sizeof(m_pendingPacket.Size) - m_pendingPacket.SizeReceived, received);
-            m_pendingPacket.SizeReceived += received;
-
-            if (status != Status::Done)
-                return status;
-        }
+        char*        data   = reinterpret_cast<char*>(&m_pendingPacket.Size) + m_pendingPacket.SizeReceived;
+        const Status status = receive(data, sizeof(m_pendingPacket.Size) - m_pendingPacket.SizeReceived, received);
+        m_pendingPacket.SizeReceived += received;
 
-        // The packet size has been fully received
-        packetSize = ntohl(m_pendingPacket.Size);
+        if (status != Status::Done)
+            return status;
     }
-    else
+
+    const std::uint32_t packetSize = ntohl(m_pendingPacket.Size);
+
+    // If the whole packet is already buffered, give it to the user packet directly from the buffer
+    ReceiveBuffer& buffer = m_receiveBuffer;
+    if (m_pendingPacket.Data.empty() && (buffer.End - buffer.Begin >= packetSize))
     {
-        // The packet size has already been received in a previous call
-        packetSize = ntohl(m_pendingPacket.Size);
+        if (packetSize > 0)
+            packet.onReceive(buffer.Data.data() + buffer.Begin, packetSize);
+
+        buffer.Begin += packetSize;
+        m_pendingPacket = PendingPacket();
+
+        return Status::Done;
     }
 
-    // Loop until we receive all the packet data
-    char buffer[1024];
+    // Loop until we receive all the packet data, directly into the pending data.
+    // Its storage grows geometrically, but no faster than data actually arrives,
+    // so that a bogus packet size can't make us allocate a huge block at once.
     while (m_pendingPacket.Data.size() < packetSize)
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.Data.size(), sizeof(buffer));
-        const Status      status    = receive(buffer, sizeToGet, received);
+        const std::size_t offset    = m_pendingPacket.Data.size();
+        const std::size_t sizeToGet = std::min(packetSize - offset, std::max(offset, receiveBufferSize));
+
+        m_pendingPacket.Data.resize(offset + sizeToGet);
+        const Status status = receive(m_pendingPacket.Data.data() + offset, sizeToGet, received);
+        m_pendingPacket.Data.resize(offset + received);
+
         if (status != Status::Done)
             return status;
-
-        // Append it into the packet
-        if (received > 0)
-        {
-            m_pendingPacket.Data.resize(m_pendingPacket.Data.size() + received);
-            std::byte* begin = m_pendingPacket.Data.data() + m_pendingPacket.Data.size() - received;
-            std::memcpy(begin, buffer, received);
-        }
     }
 
-    // We have received all the packet data: we can copy it to the user packet
+    // We have received all the packet data, hand over our storage so that it doesn't have to be copied
     if (!m_pendingPacket.Data.empty())
-        packet.onReceive(m_pendingPacket.Data.data(), m_pendingPacket.Data.size());
+        packet.onReceiveBuffer(std::move(m_pendingPacket.Data));
 
     // Clear the pending packet data
     m_pendingPacket = PendingPacket();
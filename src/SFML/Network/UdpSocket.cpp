@@ -32,11 +32,23 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cstddef>
 
 
+namespace
+{
+// Maximum number of datagrams passed to the system in a single call
+constexpr std::size_t maxDatagramsPerCall = 64;
+
+// Maximum number of packets received at once, each one needing MaxDatagramSize bytes of buffer
+constexpr std::size_t maxPacketsPerReceive = 16;
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -220,4 +232,288 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const Datagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    // First clear the variables to fill
+    sent = 0;
+
+    // Create the internal socket if it doesn't exist
+    create();
+
+    // Check all the datagrams first, so that an invalid one doesn't interrupt the batch
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+
+        if (!datagrams[i].remoteAddress.has_value())
+        {
+            err() << "Cannot send data over the network (no receiver address)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    while (sent < count)
+    {
+#if defined(SFML_SYSTEM_LINUX)
+
+        std::array<mmsghdr, maxDatagramsPerCall>                  messages{};
+        std::array<priv::SocketImpl::Buffer, maxDatagramsPerCall> buffers{};
+        std::array<sockaddr_in, maxDatagramsPerCall>              addresses{};
+
+        const std::size_t batchSize = std::min(count - sent, maxDatagramsPerCall);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const Datagram& datagram = datagrams[sent + i];
+            buffers[i]   = priv::SocketImpl::createBuffer(datagram.data, datagram.size);
+            addresses[i] = priv::SocketImpl::createAddress(datagram.remoteAddress->toInteger(), datagram.remotePort);
+
+            msghdr& header     = messages[i].msg_hdr;
+            header.msg_name    = &addresses[i];
+            header.msg_namelen = sizeof(addresses[i]);
+            header.msg_iov     = &buffers[i];
+            header.msg_iovlen  = 1;
+        }
+
+        // If a datagram fails, the following ones are left for the next call, which reports the error
+        const int    result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(batchSize), 0);
+        const Status status = (result < 0) ? priv::SocketImpl::getErrorStatus() : Status::Done;
+
+        if (result > 0)
+            sent += static_cast<std::size_t>(result);
+
+#else
+
+        const Datagram& datagram = datagrams[sent];
+        const Status    status   = send(datagram.data, datagram.size, *datagram.remoteAddress, datagram.remotePort);
+
+        if (status == Status::Done)
+            ++sent;
+
+#endif
+
+        if (status != Status::Done)
+            return ((status == Status::NotReady) && (sent > 0)) ? Status::Partial : status;
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(Datagram* datagrams, std::size_t count, std::size_t& received)
+{
+    return receiveBatch(datagrams, count, received, true);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const PacketDatagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    // First clear the variables to fill
+    sent = 0;
+
+    // See the detailed comment in send(Packet) above.
+
+    while (sent < count)
+    {
+        // Get the data to send from the packets
+        std::array<Datagram, maxDatagramsPerCall> batch;
+
+        const std::size_t batchSize = std::min(count - sent, maxDatagramsPerCall);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const PacketDatagram& datagram = datagrams[sent + i];
+            std::size_t           size     = 0;
+            const void*           data     = datagram.packet->onSend(size);
+
+            // The raw datagram is only written to when receiving
+            batch[i] = {const_cast<void*>(data), size, 0, datagram.remoteAddress, datagram.remotePort};
+        }
+
+        // Send them
+        std::size_t  batchSent = 0;
+        const Status status    = send(batch.data(), batchSize, batchSent);
+        sent += batchSent;
+
+        if (status != Status::Done)
+            return ((status == Status::NotReady) && (sent > 0)) ? Status::Partial : status;
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(PacketDatagram* datagrams, std::size_t count, std::size_t& received)
+{
+    // First clear the variables to fill
+    received = 0;
+
+    // Each packet needs its own part of the buffer, since its size is only known once it is received
+    const std::size_t bufferSize = std::min(count, maxPacketsPerReceive) * MaxDatagramSize;
+    if (m_buffer.size() < bufferSize)
+        m_buffer.resize(bufferSize);
+
+    while (received < count)
+    {
+        // Receive the datagrams (only the first one may be waited for)
+        std::array<Datagram, maxPacketsPerReceive> batch;
+
+        const std::size_t batchSize = std::min(count - received, maxPacketsPerReceive);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            batch[i].data = m_buffer.data() + i * MaxDatagramSize;
+            batch[i].size = MaxDatagramSize;
+        }
+
+        std::size_t  batchReceived = 0;
+        const Status status        = receiveBatch(batch.data(), batchSize, batchReceived, received == 0);
+
+        if (status != Status::Done)
+            return (received > 0) ? Status::Done : status;
+
+        // Copy the received data to the user packets
+        for (std::size_t i = 0; i < batchReceived; ++i)
+        {
+            PacketDatagram& datagram = datagrams[received + i];
+            datagram.packet->clear();
+            if (batch[i].received > 0)
+                datagram.packet->onReceive(batch[i].data, batch[i].received);
+
+            datagram.remoteAddress = batch[i].remoteAddress;
+            datagram.remotePort    = batch[i].remotePort;
+        }
+
+        received += batchReceived;
+
+        // Stop as soon as there are no more datagrams waiting
+        if (batchReceived < batchSize)
+            break;
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received, bool wait)
+{
+    // First clear the variables to fill
+    received = 0;
+
+    // Check the destination buffers
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!datagrams[i].data)
+        {
+            err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    while (received < count)
+    {
+        // Only the first datagram may be waited for, the next ones are taken if they are already there
+        const bool mayWait = wait && (received == 0);
+
+#if defined(SFML_SYSTEM_LINUX)
+
+        std::array<mmsghdr, maxDatagramsPerCall>                  messages{};
+        std::array<priv::SocketImpl::Buffer, maxDatagramsPerCall> buffers{};
+        std::array<sockaddr_in, maxDatagramsPerCall>              addresses{};
+
+        const std::size_t batchSize = std::min(count - received, maxDatagramsPerCall);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            buffers[i] = priv::SocketImpl::createBuffer(datagrams[received + i].data, datagrams[received + i].size);
+
+            msghdr& header     = messages[i].msg_hdr;
+            header.msg_name    = &addresses[i];
+            header.msg_namelen = sizeof(addresses[i]);
+            header.msg_iov     = &buffers[i];
+            header.msg_iovlen  = 1;
+        }
+
+        // MSG_WAITFORONE only blocks (in blocking mode) until the first datagram is received
+        const int flags  = mayWait ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int result = recvmmsg(getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(batchSize),
+                                    flags,
+                                    nullptr);
+
+        // Check for errors; if some datagrams were received, the error (if any) is left for the next call
+        if (result < 0)
+            return (received > 0) ? Status::Done : priv::SocketImpl::getErrorStatus();
+
+        // Fill the sender information
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            Datagram& datagram     = datagrams[received + i];
+            datagram.received      = messages[i].msg_len;
+            datagram.remoteAddress = IpAddress(ntohl(addresses[i].sin_addr.s_addr));
+            datagram.remotePort    = ntohs(addresses[i].sin_port);
+        }
+
+        received += static_cast<std::size_t>(result);
+
+        // Stop as soon as there are no more datagrams waiting
+        if (static_cast<std::size_t>(result) < batchSize)
+            break;
+
+#else
+
+#if defined(SFML_SYSTEM_WINDOWS)
+
+        // Windows can't be asked not to wait for a single call, a blocking socket would wait for the next datagram
+        if (!mayWait && isBlocking())
+            break;
+
+        const int flags = 0;
+
+#else
+
+        const int flags = mayWait ? 0 : MSG_DONTWAIT;
+
+#endif
+
+        Datagram&   datagram = datagrams[received];
+        sockaddr_in address  = priv::SocketImpl::createAddress(INADDR_ANY, 0);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+        // Receive a chunk of bytes
+        priv::SocketImpl::AddrLength addressSize  = sizeof(address);
+        const int                    sizeReceived = static_cast<int>(
+            recvfrom(getNativeHandle(),
+                     static_cast<char*>(datagram.data),
+                     static_cast<priv::SocketImpl::Size>(datagram.size),
+                     flags,
+                     reinterpret_cast<sockaddr*>(&address),
+                     &addressSize));
+#pragma GCC diagnostic pop
+
+        // Check for errors; if some datagrams were received, the error (if any) is left for the next call
+        if (sizeReceived < 0)
+            return (received > 0) ? Status::Done : priv::SocketImpl::getErrorStatus();
+
+        // Fill the sender information
+        datagram.received      = static_cast<std::size_t>(sizeReceived);
+        datagram.remoteAddress = IpAddress(ntohl(address.sin_addr.s_addr));
+        datagram.remotePort    = ntohs(address.sin_port);
+
+        ++received;
+
+#endif
+    }
+
+    return (received > 0) ? Status::Done : Status::NotReady;
+}
+
 } // namespace sf
@@ -29,10 +29,12 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <fcntl.h>
 #include <ostream>
 
 #include <cerrno>
+#include <climits>
 #include <cstring>
 
 
@@ -109,4 +111,40 @@ Socket::Status SocketImpl::getErrorStatus()
     // clang-format on
 }
 
+
+////////////////////////////////////////////////////////////
+SocketImpl::Buffer SocketImpl::createBuffer(const void* data, std::size_t size)
+{
+    Buffer buffer{};
+    buffer.iov_base = const_cast<void*>(data); // sendmsg doesn't write to the buffers
+    buffer.iov_len  = size;
+
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, std::size_t& sent)
+{
+    sent = 0;
+
+    // Buffers beyond IOV_MAX are left for the next call, as if they were not sent yet
+    msghdr message{};
+    message.msg_iov    = const_cast<Buffer*>(buffers);
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(std::min<std::size_t>(count, IOV_MAX));
+
+    // Use the same flags as TcpSocket, so that a closed connection doesn't raise SIGPIPE on Linux
+#ifdef SFML_SYSTEM_LINUX
+    const ssize_t result = sendmsg(sock, &message, MSG_NOSIGNAL);
+#else
+    const ssize_t result = sendmsg(sock, &message, 0);
+#endif
+
+    if (result < 0)
+        return getErrorStatus();
+
+    sent = static_cast<std::size_t>(result);
+    return Socket::Status::Done;
+}
+
 } // namespace sf::priv
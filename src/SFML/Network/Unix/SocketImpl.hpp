@@ -35,8 +35,10 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -55,6 +57,7 @@ public:
     ////////////////////////////////////////////////////////////
     using AddrLength = socklen_t;
     using Size       = std::size_t;
+    using Buffer     = iovec;
 
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
@@ -99,6 +102,33 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static Socket::Status getErrorStatus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Describe a buffer for vectored I/O
+    ///
+    /// \param data Pointer to the bytes of the buffer
+    /// \param size Number of bytes in the buffer
+    ///
+    /// \return Buffer descriptor ready to be used by sendBuffers
+    ///
+    ////////////////////////////////////////////////////////////
+    static Buffer createBuffer(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a sequence of buffers with a single system call
+    ///
+    /// Like a regular send, this may only send the first bytes
+    /// of the sequence.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Buffers to send, in order
+    /// \param count   Number of buffers
+    /// \param sent    This variable is filled with the number of bytes sent
+    ///
+    /// \return Status::Done if the call succeeded, the error status otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static Socket::Status sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, std::size_t& sent);
 };
 
 } // namespace sf::priv
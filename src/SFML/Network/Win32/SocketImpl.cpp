@@ -86,6 +86,33 @@ Socket::Status SocketImpl::getErrorStatus()
 }
 
 
+////////////////////////////////////////////////////////////
+SocketImpl::Buffer SocketImpl::createBuffer(const void* data, std::size_t size)
+{
+    Buffer buffer{};
+    buffer.len = static_cast<ULONG>(size);
+    buffer.buf = static_cast<CHAR*>(const_cast<void*>(data)); // WSASend doesn't write to the buffers
+
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, std::size_t& sent)
+{
+    sent = 0;
+
+    auto*     buffersToSend = const_cast<Buffer*>(buffers); // WSASend doesn't modify the array
+    DWORD     bytesSent     = 0;
+    const int result        = WSASend(sock, buffersToSend, static_cast<DWORD>(count), &bytesSent, 0, nullptr, nullptr);
+    if (result == SOCKET_ERROR)
+        return getErrorStatus();
+
+    sent = bytesSent;
+    return Socket::Status::Done;
+}
+
+
 ////////////////////////////////////////////////////////////
 // Windows needs some initialization and cleanup to get
 // sockets working properly... so let's create a class that will
@@ -34,6 +34,7 @@
 #include <winsock2.h>
 #include <ws2tcpip.h>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -52,6 +53,7 @@ public:
     ////////////////////////////////////////////////////////////
     using AddrLength = int;
     using Size       = int;
+    using Buffer     = WSABUF;
 
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
@@ -96,6 +98,33 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static Socket::Status getErrorStatus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Describe a buffer for vectored I/O
+    ///
+    /// \param data Pointer to the bytes of the buffer
+    /// \param size Number of bytes in the buffer
+    ///
+    /// \return Buffer descriptor ready to be used by sendBuffers
+    ///
+    ////////////////////////////////////////////////////////////
+    static Buffer createBuffer(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a sequence of buffers with a single system call
+    ///
+    /// Like a regular send, this may only send the first bytes
+    /// of the sequence.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Buffers to send, in order
+    /// \param count   Number of buffers
+    /// \param sent    This variable is filled with the number of bytes sent
+    ///
+    /// \return Status::Done if the call succeeded, the error status otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static Socket::Status sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, std::size_t& sent);
 };
 
 } // namespace sf::priv
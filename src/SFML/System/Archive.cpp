@@ -0,0 +1,313 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Archive.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Lz4.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ArchiveImpl
+{
+// An archive starts with a header, followed by the index, the names of the entries and finally their data.
+// All integers are stored in little endian byte order.
+constexpr char          magic[4]       = {'S', 'F', 'P', 'K'};
+constexpr std::uint32_t version        = 1;
+constexpr std::size_t   headerSize     = 16; // Magic, version, entry count, reserved
+constexpr std::size_t   entrySize      = 48; // Hash, offset, stored size, size, name offset, name size, flags, reserved
+constexpr std::uint32_t compressedFlag = 1;
+
+template <typename T>
+T readLittleEndian(const std::byte* data)
+{
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(std::to_integer<T>(data[i]) << (8 * i));
+
+    return value;
+}
+
+template <typename T>
+void writeLittleEndian(std::vector<std::byte>& output, T value)
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        output.push_back(static_cast<std::byte>((value >> (8 * i)) & 0xFF));
+}
+
+// Entries are identified by their path relative to the packed directory, with '/' separators
+std::string getEntryName(const std::filesystem::path& path)
+{
+    return path.lexically_normal().generic_string();
+}
+
+// 64-bit FNV-1a, stored in the index so that it doesn't depend on the standard library implementation
+std::uint64_t hashName(std::string_view name)
+{
+    std::uint64_t hash = 14695981039346656037u;
+    for (const char character : name)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211u;
+    }
+
+    return hash;
+}
+} // namespace ArchiveImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Archive::Archive() = default;
+
+
+////////////////////////////////////////////////////////////
+Archive::~Archive() = default;
+
+
+////////////////////////////////////////////////////////////
+Archive::Archive(Archive&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Archive& Archive::operator=(Archive&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool Archive::create(const std::filesystem::path& filename, const std::filesystem::path& directory, bool compress)
+{
+    using namespace ArchiveImpl;
+
+    // List the files to pack, sorted so that the archive doesn't depend on the order of the directory listing
+    std::vector<std::filesystem::path> files;
+    std::error_code                    error;
+    for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && (it != end);
+         it.increment(error))
+    {
+        // Skip the archive itself if it's written inside the packed directory
+        std::error_code ignored;
+        if (it->is_regular_file(ignored) && !std::filesystem::equivalent(it->path(), filename, ignored))
+            files.push_back(it->path());
+    }
+
+    if (error)
+    {
+        err() << "Failed to create archive, couldn't list the files of the directory (" << error.message() << ")\n"
+              << formatDebugPathInfo(directory) << std::endl;
+        return false;
+    }
+
+    std::sort(files.begin(), files.end());
+
+    std::vector<std::byte>            index;
+    std::vector<std::byte>            names;
+    std::vector<std::byte>            data;
+    std::unordered_set<std::uint64_t> hashes;
+
+    // The names of the entries are stored right after the index, followed by their data
+    const std::uint64_t namesOffset = headerSize + files.size() * entrySize;
+    std::uint64_t       dataOffset  = namesOffset;
+    for (const std::filesystem::path& file : files)
+        dataOffset += getEntryName(file.lexically_relative(directory)).size();
+
+    for (const std::filesystem::path& file : files)
+    {
+        MappedFileInputStream stream;
+        if (!stream.open(file))
+        {
+            err() << "Failed to create archive, couldn't open file\n" << formatDebugPathInfo(file) << std::endl;
+            return false;
+        }
+
+        const std::string   name = getEntryName(file.lexically_relative(directory));
+        const std::uint64_t hash = hashName(name);
+        if (!hashes.insert(hash).second)
+        {
+            err() << "Failed to create archive, the path of an entry collides with another one\n"
+                  << formatDebugPathInfo(file) << std::endl;
+            return false;
+        }
+
+        const auto* contents = static_cast<const std::byte*>(stream.getData());
+        const auto  size     = static_cast<std::size_t>(stream.getSize());
+
+        // Only keep the compressed data if it's actually smaller
+        std::vector<std::byte> compressed;
+        if (compress && (size > 0))
+            compressed = priv::compressLz4(contents, size);
+
+        const bool isCompressed = !compressed.empty() && (compressed.size() < size);
+
+        writeLittleEndian<std::uint64_t>(index, hash);
+        writeLittleEndian<std::uint64_t>(index, dataOffset + data.size());
+        writeLittleEndian<std::uint64_t>(index, isCompressed ? compressed.size() : size);
+        writeLittleEndian<std::uint64_t>(index, size);
+        writeLittleEndian<std::uint32_t>(index, static_cast<std::uint32_t>(namesOffset + names.size()));
+        writeLittleEndian<std::uint32_t>(index, static_cast<std::uint32_t>(name.size()));
+        writeLittleEndian<std::uint32_t>(index, isCompressed ? compressedFlag : 0);
+        writeLittleEndian<std::uint32_t>(index, 0);
+
+        const auto* nameBytes = reinterpret_cast<const std::byte*>(name.data());
+        names.insert(names.end(), nameBytes, nameBytes + name.size());
+
+        if (isCompressed)
+            data.insert(data.end(), compressed.begin(), compressed.end());
+        else
+            data.insert(data.end(), contents, contents + size);
+    }
+
+    std::vector<std::byte> header;
+    const auto*            magicBytes = reinterpret_cast<const std::byte*>(magic);
+    header.insert(header.end(), magicBytes, magicBytes + sizeof(magic));
+    writeLittleEndian<std::uint32_t>(header, version);
+    writeLittleEndian<std::uint32_t>(header, static_cast<std::uint32_t>(files.size()));
+    writeLittleEndian<std::uint32_t>(header, 0);
+
+    std::ofstream output(filename, std::ios_base::binary);
+    for (const std::vector<std::byte>* part : {&header, &index, &names, &data})
+        output.write(reinterpret_cast<const char*>(part->data()), static_cast<std::streamsize>(part->size()));
+
+    if (!output)
+    {
+        err() << "Failed to create archive, couldn't write the file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Archive::open(const std::filesystem::path& filename)
+{
+    using namespace ArchiveImpl;
+
+    // Close the previous archive
+    *this = Archive();
+
+    const auto fail = [this, &filename](const char* reason)
+    {
+        err() << "Failed to open archive (" << reason << ")\n" << formatDebugPathInfo(filename) << std::endl;
+        *this = Archive();
+        return false;
+    };
+
+    if (!m_file.open(filename))
+        return fail("couldn't open the file");
+
+    const auto*         archive     = static_cast<const std::byte*>(m_file.getData());
+    const auto          archiveSize = static_cast<std::uint64_t>(m_file.getSize());
+    const std::uint64_t entryCount  = archiveSize >= headerSize ? readLittleEndian<std::uint32_t>(archive + 8) : 0;
+
+    if ((archiveSize < headerSize) || (std::memcmp(archive, magic, sizeof(magic)) != 0))
+        return fail("not an archive");
+
+    if (readLittleEndian<std::uint32_t>(archive + 4) != version)
+        return fail("unsupported version");
+
+    if (entryCount > (archiveSize - headerSize) / entrySize)
+        return fail("truncated index");
+
+    // Load the index and check that all the entries lie inside the archive
+    m_entries.resize(static_cast<std::size_t>(entryCount));
+    m_index.reserve(m_entries.size());
+
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+        const std::byte*    entry      = archive + headerSize + i * entrySize;
+        const auto          hash       = readLittleEndian<std::uint64_t>(entry);
+        const auto          offset     = readLittleEndian<std::uint64_t>(entry + 8);
+        const auto          storedSize = readLittleEndian<std::uint64_t>(entry + 16);
+        const auto          size       = readLittleEndian<std::uint64_t>(entry + 24);
+        const std::uint64_t nameOffset = readLittleEndian<std::uint32_t>(entry + 32);
+        const std::uint64_t nameSize   = readLittleEndian<std::uint32_t>(entry + 36);
+        const auto          flags      = readLittleEndian<std::uint32_t>(entry + 40);
+
+        if ((offset > archiveSize) || (storedSize > archiveSize - offset) || (nameOffset + nameSize > archiveSize))
+            return fail("entry out of bounds");
+
+        // LZ4 can't expand data more than 255 times, anything bigger is corrupted
+        const bool compressed = flags & compressedFlag;
+        if (compressed ? (size / 255 > storedSize) : (size != storedSize))
+            return fail("invalid entry size");
+
+        m_entries[i].name       = std::string_view(reinterpret_cast<const char*>(archive + nameOffset),
+                                             static_cast<std::size_t>(nameSize));
+        m_entries[i].data       = archive + offset;
+        m_entries[i].storedSize = storedSize;
+        m_entries[i].size       = size;
+        m_entries[i].compressed = compressed;
+
+        if ((hashName(m_entries[i].name) != hash) || !m_index.emplace(hash, i).second)
+            return fail("corrupted index");
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Archive::contains(const std::filesystem::path& name) const
+{
+    return findEntry(name) != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Archive::getEntryCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Archive::Entry* Archive::findEntry(const std::filesystem::path& name) const
+{
+    using namespace ArchiveImpl;
+
+    const std::string key = getEntryName(name);
+    const auto        it  = m_index.find(hashName(key));
+    if ((it == m_index.end()) || (m_entries[it->second].name != key))
+        return nullptr;
+
+    return &m_entries[it->second];
+}
+
+} // namespace sf
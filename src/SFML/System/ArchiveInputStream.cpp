@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Archive.hpp>
+#include <SFML/System/ArchiveInputStream.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Lz4.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ArchiveInputStream::ArchiveInputStream() = default;
+
+
+////////////////////////////////////////////////////////////
+ArchiveInputStream::ArchiveInputStream(ArchiveInputStream&& right) noexcept :
+m_data(std::exchange(right.m_data, nullptr)),
+m_size(std::exchange(right.m_size, 0)),
+m_offset(std::exchange(right.m_offset, 0)),
+m_buffer(std::move(right.m_buffer))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ArchiveInputStream& ArchiveInputStream::operator=(ArchiveInputStream&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    // Moving the buffer keeps its storage, so m_data stays valid
+    m_data   = std::exchange(right.m_data, nullptr);
+    m_size   = std::exchange(right.m_size, 0);
+    m_offset = std::exchange(right.m_offset, 0);
+    m_buffer = std::move(right.m_buffer);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ArchiveInputStream::open(const Archive& archive, const std::filesystem::path& name)
+{
+    m_data   = nullptr;
+    m_size   = 0;
+    m_offset = 0;
+    m_buffer = {};
+
+    const Archive::Entry* entry = archive.findEntry(name);
+    if (!entry)
+    {
+        err() << "Failed to open archive entry \"" << name.generic_string() << "\" (not found)" << std::endl;
+        return false;
+    }
+
+    if (entry->compressed)
+    {
+        const auto storedSize = static_cast<std::size_t>(entry->storedSize);
+        m_buffer.resize(static_cast<std::size_t>(entry->size));
+        if (!priv::decompressLz4(entry->data, storedSize, m_buffer.data(), m_buffer.size()))
+        {
+            err() << "Failed to open archive entry \"" << name.generic_string() << "\" (corrupted data)" << std::endl;
+            m_buffer = {};
+            return false;
+        }
+
+        m_data = m_buffer.data();
+    }
+    else
+    {
+        // Stored entries are read in place, from the mapped archive
+        m_data = entry->data;
+    }
+
+    m_size = static_cast<std::int64_t>(entry->size);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t ArchiveInputStream::read(void* data, std::int64_t size)
+{
+    if (!m_data)
+        return -1;
+
+    const std::int64_t endPosition = m_offset + size;
+    const std::int64_t count       = endPosition <= m_size ? size : m_size - m_offset;
+
+    if (count > 0)
+    {
+        std::memcpy(data, m_data + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t ArchiveInputStream::seek(std::int64_t position)
+{
+    if (!m_data)
+        return -1;
+
+    m_offset = position < m_size ? position : m_size;
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t ArchiveInputStream::tell()
+{
+    if (!m_data)
+        return -1;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t ArchiveInputStream::getSize()
+{
+    if (!m_data)
+        return -1;
+
+    return m_size;
+}
+
+} // namespace sf
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Lz4.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace Lz4Impl
+{
+constexpr std::size_t minMatch     = 4;     // Shortest match that can be encoded
+constexpr std::size_t maxOffset    = 65535; // Matches are encoded with a 16-bit offset
+constexpr std::size_t lastLiterals = 5;     // The last bytes of a block are always literals
+constexpr std::size_t matchEnd     = 12;    // The last match must start this many bytes before the end
+constexpr int         hashBits     = 16;
+
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::size_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+// Lengths are stored in 4 bits, followed by as many bytes as needed if they don't fit
+void writeLength(std::vector<std::byte>& output, std::size_t length)
+{
+    for (length -= 15; length >= 255; length -= 255)
+        output.push_back(std::byte{255});
+    output.push_back(static_cast<std::byte>(length));
+}
+
+bool readLength(const std::byte* data, std::size_t size, std::size_t& position, std::size_t& length)
+{
+    std::byte value{255};
+    while (value == std::byte{255})
+    {
+        if (position == size)
+            return false;
+
+        value = data[position++];
+        length += std::to_integer<std::size_t>(value);
+    }
+
+    return true;
+}
+
+void writeSequence(std::vector<std::byte>& output,
+                   const std::byte*        literals,
+                   std::size_t             literalCount,
+                   std::size_t             offset,
+                   std::size_t             matchLength)
+{
+    const std::size_t encodedMatch = matchLength > 0 ? matchLength - minMatch : 0;
+    output.push_back(static_cast<std::byte>((std::min<std::size_t>(literalCount, 15) << 4) |
+                                            std::min<std::size_t>(encodedMatch, 15)));
+
+    if (literalCount >= 15)
+        writeLength(output, literalCount);
+
+    output.insert(output.end(), literals, literals + literalCount);
+
+    // The final sequence has no match
+    if (matchLength == 0)
+        return;
+
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+
+    if (encodedMatch >= 15)
+        writeLength(output, encodedMatch);
+}
+} // namespace Lz4Impl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::vector<std::byte> compressLz4(const std::byte* data, std::size_t size)
+{
+    using namespace Lz4Impl;
+
+    std::vector<std::byte> output;
+    output.reserve(size + size / 255 + 16);
+
+    std::size_t anchor   = 0;
+    std::size_t position = 0;
+
+    if (size > matchEnd)
+    {
+        // Position of the last occurrence of each hashed 4-byte sequence
+        std::vector<std::size_t> table(std::size_t{1} << hashBits);
+
+        while (position < size - matchEnd)
+        {
+            const std::uint32_t sequence  = read32(data + position);
+            const std::size_t   candidate = std::exchange(table[hash(sequence)], position);
+
+            if ((candidate >= position) || (position - candidate > maxOffset) || (read32(data + candidate) != sequence))
+            {
+                ++position;
+                continue;
+            }
+
+            // Extend the match as far as possible, leaving the last literals alone
+            const std::size_t maxLength = size - lastLiterals - position;
+            std::size_t       length    = minMatch;
+            while ((length < maxLength) && (data[candidate + length] == data[position + length]))
+                ++length;
+
+            writeSequence(output, data + anchor, position - anchor, position - candidate, length);
+
+            position += length;
+            anchor = position;
+        }
+    }
+
+    writeSequence(output, data + anchor, size - anchor, 0, 0);
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompressLz4(const std::byte* data, std::size_t size, std::byte* output, std::size_t decompressedSize)
+{
+    using namespace Lz4Impl;
+
+    std::size_t input    = 0;
+    std::size_t position = 0;
+
+    while (input < size)
+    {
+        const auto token = std::to_integer<std::size_t>(data[input++]);
+
+        // Copy the literals
+        std::size_t literalCount = token >> 4;
+        if ((literalCount == 15) && !readLength(data, size, input, literalCount))
+            return false;
+
+        if ((literalCount > size - input) || (literalCount > decompressedSize - position))
+            return false;
+
+        if (literalCount > 0)
+            std::memcpy(output + position, data + input, literalCount);
+        input += literalCount;
+        position += literalCount;
+
+        // The block ends after the literals of the final sequence
+        if (input == size)
+            break;
+
+        // Copy the match, which may overlap the bytes it produces
+        if (size - input < 2)
+            return false;
+
+        const std::size_t offset = std::to_integer<std::size_t>(data[input]) |
+                                   (std::to_integer<std::size_t>(data[input + 1]) << 8);
+        input += 2;
+
+        std::size_t matchLength = token & 0xF;
+        if ((matchLength == 15) && !readLength(data, size, input, matchLength))
+            return false;
+        matchLength += minMatch;
+
+        if ((offset == 0) || (offset > position) || (matchLength > decompressedSize - position))
+            return false;
+
+        for (std::size_t i = 0; i < matchLength; ++i, ++position)
+            output[position] = output[position - offset];
+    }
+
+    return position == decompressedSize;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Compress a block of data in the LZ4 block format
+///
+/// \param data Data to compress
+/// \param size Size of the data, in bytes
+///
+/// \return Compressed data
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::byte> compressLz4(const std::byte* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a block of data in the LZ4 block format
+///
+/// The input is fully validated, malformed data makes
+/// the function fail instead of reading or writing out
+/// of bounds.
+///
+/// \param data             Compressed data
+/// \param size             Size of the compressed data, in bytes
+/// \param output           Buffer to fill with the decompressed data
+/// \param decompressedSize Exact size of the decompressed data, in bytes
+///
+/// \return True if the data was decompressed successfully
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decompressLz4(const std::byte* data,
+                                 std::size_t      size,
+                                 std::byte*       output,
+                                 std::size_t      decompressedSize);
+
+} // namespace sf::priv
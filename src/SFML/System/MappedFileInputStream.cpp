@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2023 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#if defined(SFML_SYSTEM_ANDROID)
+#include <SFML/System/Android/ResourceStream.hpp>
+#elif defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/WindowsHeader.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+#include <cstring>
+
+
+namespace
+{
+// Empty files can't be mapped, they point here so that the stream still counts as open
+const std::byte emptyFile{};
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream() = default;
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(MappedFileInputStream&& right) noexcept :
+m_data(std::exchange(right.m_data, nullptr)),
+m_size(std::exchange(right.m_size, 0)),
+m_offset(std::exchange(right.m_offset, 0))
+{
+#ifdef SFML_SYSTEM_ANDROID
+    // Moving the vector keeps its storage, so m_data stays valid
+    m_buffer = std::move(right.m_buffer);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream& MappedFileInputStream::operator=(MappedFileInputStream&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    close();
+
+    m_data   = std::exchange(right.m_data, nullptr);
+    m_size   = std::exchange(right.m_size, 0);
+    m_offset = std::exchange(right.m_offset, 0);
+#ifdef SFML_SYSTEM_ANDROID
+    m_buffer = std::move(right.m_buffer);
+#endif
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileInputStream::open(const std::filesystem::path& filename)
+{
+    close();
+
+    const void*  data = nullptr;
+    std::int64_t size = 0;
+
+#if defined(SFML_SYSTEM_ANDROID)
+
+    // Assets are compressed in the APK, read them in memory instead
+    priv::ResourceStream stream(filename);
+    size = stream.getSize();
+    if (size < 0)
+        return false;
+
+    m_buffer.resize(static_cast<std::size_t>(size));
+    if ((size > 0) && (stream.read(m_buffer.data(), size) != size))
+    {
+        m_buffer = {};
+        return false;
+    }
+
+    data = m_buffer.data();
+
+#elif defined(SFML_SYSTEM_WINDOWS)
+
+    const HANDLE file = CreateFileW(filename.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    size = fileSize.QuadPart;
+    if (size > 0)
+    {
+        // The view keeps the file and the mapping object alive, their handles can be closed right away
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+
+        if (!data)
+        {
+            CloseHandle(file);
+            return false;
+        }
+    }
+
+    CloseHandle(file);
+
+#else
+
+    const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return false;
+
+    struct stat status{};
+    if ((fstat(file, &status) == -1) || !S_ISREG(status.st_mode))
+    {
+        ::close(file);
+        return false;
+    }
+
+    size = static_cast<std::int64_t>(status.st_size);
+    if (size > 0)
+    {
+        // The mapping keeps the file alive, its descriptor can be closed right away
+        void* mapped = mmap(nullptr, static_cast<std::size_t>(size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapped == MAP_FAILED)
+        {
+            ::close(file);
+            return false;
+        }
+
+        // Resources are usually read entirely, let the kernel start reading ahead
+        madvise(mapped, static_cast<std::size_t>(size), MADV_WILLNEED);
+        data = mapped;
+    }
+
+    ::close(file);
+
+#endif
+
+    m_data   = size > 0 ? static_cast<const std::byte*>(data) : &emptyFile;
+    m_size   = size;
+    m_offset = 0;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileInputStream::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::read(void* data, std::int64_t size)
+{
+    if (!m_data)
+        return -1;
+
+    const std::int64_t endPosition = m_offset + size;
+    const std::int64_t count       = endPosition <= m_size ? size : m_size - m_offset;
+
+    if (count > 0)
+    {
+        std::memcpy(data, m_data + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::seek(std::int64_t position)
+{
+    if (!m_data)
+        return -1;
+
+    m_offset = position < m_size ? position : m_size;
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::tell()
+{
+    if (!m_data)
+        return -1;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::getSize()
+{
+    if (!m_data)
+        return -1;
+
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileInputStream::close()
+{
+#if defined(SFML_SYSTEM_ANDROID)
+    m_buffer = {};
+#elif defined(SFML_SYSTEM_WINDOWS)
+    if (m_data && (m_data != &emptyFile))
+        UnmapViewOfFile(m_data);
+#else
+    if (m_data && (m_data != &emptyFile))
+        munmap(const_cast<std::byte*>(m_data), static_cast<std::size_t>(m_size));
+#endif
+
+    m_data   = nullptr;
+    m_size   = 0;
+    m_offset = 0;
+}
+
+} // namespace sf
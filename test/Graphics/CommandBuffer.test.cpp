@@ -0,0 +1,118 @@
+#include <SFML/Graphics/CommandBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Instance.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::CommandBuffer", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::CommandBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::CommandBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::CommandBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::CommandBuffer>);
+        STATIC_CHECK(std::is_base_of_v<sf::RenderTarget, sf::CommandBuffer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::CommandBuffer commandBuffer({640, 480});
+        CHECK(commandBuffer.getCommandCount() == 0);
+        CHECK(commandBuffer.getSize() == sf::Vector2u(640, 480));
+        CHECK(commandBuffer.getDefaultView().getSize() == sf::Vector2f(640, 480));
+        CHECK(commandBuffer.getViewport(commandBuffer.getView()) == sf::IntRect({0, 0}, {640, 480}));
+        CHECK(commandBuffer.mapPixelToCoords({320, 240}) == sf::Vector2f(320, 240));
+    }
+
+    SECTION("Recording")
+    {
+        sf::CommandBuffer commandBuffer({640, 480});
+        CHECK(!commandBuffer.setActive());
+
+        commandBuffer.draw(sf::RectangleShape({10, 10}));
+        CHECK(commandBuffer.getCommandCount() == 1);
+
+        const sf::View view(sf::FloatRect({0, 0}, {20, 20}));
+        commandBuffer.setView(view);
+        CHECK(commandBuffer.getCommandCount() == 2);
+        CHECK(commandBuffer.getView().getSize() == view.getSize());
+
+        commandBuffer.clear(sf::Color::Red);
+        CHECK(commandBuffer.getCommandCount() == 3);
+
+        commandBuffer.reset();
+        CHECK(commandBuffer.getCommandCount() == 0);
+    }
+
+    SECTION("Replay")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({16, 16}));
+
+        sf::RectangleShape shape({8, 8});
+        shape.setFillColor(sf::Color::Red);
+
+        // Zoom on the top-left quarter so that the shape covers the whole target
+        sf::CommandBuffer commandBuffer(renderTexture.getSize());
+        commandBuffer.clear(sf::Color::Blue);
+        commandBuffer.setView(sf::View(sf::FloatRect({0, 0}, {8, 8})));
+        commandBuffer.draw(shape);
+
+        renderTexture.clear();
+        renderTexture.draw(commandBuffer);
+        renderTexture.display();
+
+        CHECK(renderTexture.getView().getSize() == sf::Vector2f(8, 8));
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({12, 12}) == sf::Color::Red);
+    }
+
+    SECTION("Replay of vertex, index and instance buffers")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({16, 16}));
+
+        sf::VertexBuffer quad(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Static);
+        if (!quad.create(4))
+            return;
+        const std::array vertices = {sf::Vertex({0, 0}), sf::Vertex({8, 0}), sf::Vertex({0, 8}), sf::Vertex({8, 8})};
+        REQUIRE(quad.update(vertices.data()));
+
+        sf::IndexBuffer indices(sf::IndexBuffer::UInt16, sf::IndexBuffer::Static);
+        REQUIRE(indices.create(4));
+        const std::array<std::uint16_t, 4> indexData = {0, 1, 2, 3};
+        REQUIRE(indices.update(indexData.data()));
+
+        std::array<sf::Instance, 1> instances;
+        instances[0].color = sf::Color::Green;
+        instances[0].transform.translate({8, 8});
+
+        sf::CommandBuffer commandBuffer(renderTexture.getSize());
+        commandBuffer.draw(quad, indices);
+        commandBuffer.drawInstanced(quad, instances.data(), instances.size());
+        CHECK(commandBuffer.getCommandCount() == 2);
+
+        // The recorded instances are copies
+        instances[0].color = sf::Color::Red;
+
+        renderTexture.clear();
+        renderTexture.draw(commandBuffer);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::White);
+        CHECK(image.getPixel({12, 12}) == sf::Color::Green);
+    }
+}
@@ -0,0 +1,91 @@
+#include <SFML/Graphics/DrawQueue.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+namespace
+{
+class EmptyDrawable : public sf::Drawable
+{
+private:
+    void draw(sf::RenderTarget&, const sf::RenderStates&) const override
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("[Graphics] sf::DrawQueue", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::DrawQueue>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::DrawQueue>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::DrawQueue>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::DrawQueue>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::DrawQueue queue;
+        CHECK(queue.getSize() == 0);
+    }
+
+    SECTION("submit()")
+    {
+        sf::DrawQueue queue;
+
+        SECTION("Drawable without primitives")
+        {
+            queue.submit(EmptyDrawable());
+            CHECK(queue.getSize() == 0);
+        }
+
+        SECTION("Shapes")
+        {
+            const sf::RectangleShape shape({10, 10});
+            queue.submit(shape);
+            queue.submit(shape, 2, 1.f);
+            CHECK(queue.getSize() == 2);
+        }
+    }
+
+    SECTION("clear()")
+    {
+        sf::DrawQueue queue;
+        queue.submit(sf::RectangleShape({10, 10}));
+        queue.clear();
+        CHECK(queue.getSize() == 0);
+    }
+
+    SECTION("draw()")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({16, 16}));
+
+        sf::RectangleShape front({16, 16});
+        front.setFillColor(sf::Color::Red);
+        sf::RectangleShape back({16, 16});
+        back.setFillColor(sf::Color::Green);
+
+        // Layers are drawn in order, whatever the submission order
+        sf::DrawQueue queue;
+        queue.submit(front, 1);
+        queue.submit(back, 0);
+        CHECK(queue.getSize() == 2);
+
+        renderTexture.clear();
+        queue.draw(renderTexture);
+        renderTexture.display();
+
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({8, 8}) == sf::Color::Red);
+        CHECK(queue.getSize() == 2);
+    }
+}
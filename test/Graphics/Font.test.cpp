@@ -3,7 +3,10 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -24,6 +27,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         CHECK(font.getUnderlinePosition(0) == 0);
         CHECK(font.getUnderlineThickness(0) == 0);
         CHECK(font.isSmooth());
+        CHECK(!font.isDistanceFieldEnabled());
     }
 
     SECTION("loadFromFile()")
@@ -59,4 +63,161 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Set/get distance field enabled")
+    {
+        sf::Font font;
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+        const sf::Font copy(font);
+        CHECK(copy.isDistanceFieldEnabled());
+        font.setDistanceFieldEnabled(false);
+        CHECK(!font.isDistanceFieldEnabled());
+    }
+
+    SECTION("getDistanceFieldGlyph()")
+    {
+        constexpr auto size   = sf::Font::DistanceFieldCharacterSize;
+        constexpr auto spread = sf::Font::DistanceFieldSpread;
+
+        sf::Font font;
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+        const sf::Glyph glyph   = font.getGlyph(0x45, size, false);
+        const float     kerning = font.getKerning(0x41, 0x56, size);
+
+        font.setDistanceFieldEnabled(true);
+        font.setSmooth(false);
+        const auto& distanceFieldGlyph = font.getDistanceFieldGlyph(0x45, false);
+        CHECK(distanceFieldGlyph.advance == glyph.advance);
+        CHECK(distanceFieldGlyph.lsbDelta == glyph.lsbDelta);
+        CHECK(distanceFieldGlyph.rsbDelta == glyph.rsbDelta);
+        CHECK(distanceFieldGlyph.bounds.getPosition() == glyph.bounds.getPosition() - sf::Vector2f(spread, spread));
+        CHECK(distanceFieldGlyph.bounds.getSize() == glyph.bounds.getSize() + sf::Vector2f(2 * spread, 2 * spread));
+        CHECK(sf::Vector2f(distanceFieldGlyph.textureRect.getSize()) == distanceFieldGlyph.bounds.getSize());
+        CHECK(font.getDistanceFieldGlyph(0x20, false).textureRect == sf::IntRect());
+        CHECK(font.getDistanceFieldGlyph(0x45, true).advance == glyph.advance + 2);
+        CHECK(font.getKerning(0x41, 0x56, size) == kerning);
+
+        const auto& texture = font.getDistanceFieldTexture();
+        CHECK(texture.isSmooth());
+        CHECK(&texture != &font.getTexture(size));
+    }
+
+    SECTION("prewarm()")
+    {
+        sf::Font reference;
+        REQUIRE(reference.loadFromFile("Graphics/tuffy.ttf"));
+
+        sf::Font font;
+        CHECK(!font.isPrewarming());
+        font.prewarm("ABC", {16, 24});
+        CHECK(!font.isPrewarming());
+
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+        font.prewarm("Hello, World!", {16, 24}, true);
+        font.waitForPrewarm();
+        CHECK(!font.isPrewarming());
+
+        for (const auto size : {16u, 24u})
+        {
+            for (const char32_t codePoint : std::u32string(U"Hello, World!"))
+            {
+                const auto& glyph    = font.getGlyph(codePoint, size, true);
+                const auto& expected = reference.getGlyph(codePoint, size, true);
+                CHECK(glyph.advance == expected.advance);
+                CHECK(glyph.bounds == expected.bounds);
+                CHECK(glyph.textureRect.getSize() == expected.textureRect.getSize());
+            }
+        }
+
+        const sf::Font copy(font);
+        copy.prewarm("Hello", {16});
+        CHECK(!copy.isPrewarming());
+    }
+
+    SECTION("Glyph table")
+    {
+        // Enough code points to grow the table several times, on both sides of the Latin-1 range
+        std::u32string codePoints;
+        for (char32_t codePoint = 0x20; codePoint < 0x7F; ++codePoint)
+            codePoints += codePoint;
+        for (char32_t codePoint = 0xA0; codePoint < 0x120; ++codePoint)
+            codePoints += codePoint;
+        REQUIRE(codePoints.size() > 200);
+
+        constexpr unsigned int size = 16;
+
+        const auto forEachGlyph = [](std::u32string_view range, const auto& func)
+        {
+            for (const char32_t codePoint : range)
+            {
+                for (const bool bold : {false, true})
+                {
+                    for (const float outlineThickness : {0.f, 1.f})
+                        func(codePoint, bold, outlineThickness);
+                }
+            }
+        };
+
+        const auto checkGlyph = [](const sf::Glyph& glyph, const sf::Glyph& expected)
+        {
+            CHECK(glyph.advance == expected.advance);
+            CHECK(glyph.lsbDelta == expected.lsbDelta);
+            CHECK(glyph.rsbDelta == expected.rsbDelta);
+            CHECK(glyph.bounds == expected.bounds);
+            CHECK(glyph.textureRect == expected.textureRect);
+        };
+
+        sf::Font font;
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+
+        // Keep references to the first glyphs, taken while the table is still small
+        const std::u32string_view     early = std::u32string_view(codePoints).substr(0, 8);
+        std::vector<const sf::Glyph*> earlyGlyphs;
+        std::vector<sf::Glyph>        earlyValues;
+        forEachGlyph(early,
+                     [&](char32_t codePoint, bool bold, float outlineThickness)
+                     {
+                         const auto& glyph = font.getGlyph(codePoint, size, bold, outlineThickness);
+                         earlyGlyphs.push_back(&glyph);
+                         earlyValues.push_back(glyph);
+                     });
+
+        std::vector<const sf::Glyph*> glyphs;
+        forEachGlyph(codePoints,
+                     [&](char32_t codePoint, bool bold, float outlineThickness)
+                     { glyphs.push_back(&font.getGlyph(codePoint, size, bold, outlineThickness)); });
+
+        // Load the same glyphs in the same order, so that the texture rectangles match as well
+        sf::Font reference;
+        REQUIRE(reference.loadFromFile("Graphics/tuffy.ttf"));
+        std::size_t index = 0;
+        forEachGlyph(codePoints,
+                     [&](char32_t codePoint, bool bold, float outlineThickness)
+                     { checkGlyph(*glyphs[index++], reference.getGlyph(codePoint, size, bold, outlineThickness)); });
+
+        index = 0;
+        forEachGlyph(early,
+                     [&](char32_t codePoint, bool bold, float outlineThickness)
+                     {
+                         CHECK(&font.getGlyph(codePoint, size, bold, outlineThickness) == earlyGlyphs[index]);
+                         checkGlyph(*earlyGlyphs[index], earlyValues[index]);
+                         ++index;
+                     });
+
+        for (const char32_t codePoint : std::u32string(U"AZ\u00C0\u00E9"))
+        {
+            const auto& regular = font.getGlyph(codePoint, size, false);
+            CHECK(font.getGlyph(codePoint, size, true).bounds != regular.bounds);
+            CHECK(font.getGlyph(codePoint, size, false, 1).bounds != regular.bounds);
+        }
+
+        const sf::Font copy(font);
+        forEachGlyph(codePoints,
+                     [&](char32_t codePoint, bool bold, float outlineThickness)
+                     {
+                         checkGlyph(copy.getGlyph(codePoint, size, bold, outlineThickness),
+                                    font.getGlyph(codePoint, size, bold, outlineThickness));
+                     });
+    }
 }
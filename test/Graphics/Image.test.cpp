@@ -4,7 +4,9 @@
 
 #include <GraphicsUtil.hpp>
 #include <array>
+#include <filesystem>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -129,6 +131,49 @@ TEST_CASE("[Graphics] sf::Image")
         CHECK(image.getPixelsPtr() != nullptr);
     }
 
+    SECTION("loadFromFiles()")
+    {
+        const std::vector<std::filesystem::path> filenames = {"Graphics/sfml-logo-big.bmp",
+                                                              "Graphics/sfml-logo-big.png",
+                                                              "does/not/exist.png",
+                                                              "Graphics/sfml-logo-big.jpg",
+                                                              "Graphics/sfml-logo-big.psd"};
+        std::vector<sf::Image>                   images;
+
+        SECTION("Default thread count")
+        {
+            CHECK(sf::Image::loadFromFiles(filenames, images) == 4);
+        }
+
+        SECTION("Single thread")
+        {
+            CHECK(sf::Image::loadFromFiles(filenames, images, 1) == 4);
+        }
+
+        SECTION("More threads than files")
+        {
+            CHECK(sf::Image::loadFromFiles(filenames, images, 16) == 4);
+        }
+
+        REQUIRE(images.size() == filenames.size());
+        for (std::size_t i = 0; i < images.size(); ++i)
+        {
+            if (i == 2)
+            {
+                CHECK(images[i].getSize() == sf::Vector2u());
+                CHECK(images[i].getPixelsPtr() == nullptr);
+            }
+            else
+            {
+                CHECK(images[i].getSize() == sf::Vector2u(1001, 304));
+                CHECK(images[i].getPixel({200, 150}) == sf::Color(144, 208, 62));
+            }
+        }
+
+        CHECK(sf::Image::loadFromFiles({}, images) == 0);
+        CHECK(images.empty());
+    }
+
     SECTION("saveToFile()")
     {
         sf::Image image;
@@ -0,0 +1,24 @@
+#include <SFML/Graphics/Instance.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::Instance")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::Instance>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::Instance>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Instance>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Instance>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::Instance instance;
+        CHECK(instance.transform == sf::Transform::Identity);
+        CHECK(instance.color == sf::Color::White);
+    }
+}
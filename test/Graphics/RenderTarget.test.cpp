@@ -1,9 +1,11 @@
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <SystemUtil.hpp>
+#include <optional>
 #include <type_traits>
 
 class RenderTarget : public sf::RenderTarget
@@ -18,6 +20,29 @@ private:
     }
 };
 
+class CulledDrawable : public sf::Drawable
+{
+public:
+    CulledDrawable(const sf::FloatRect& bounds, const sf::Drawable* child) : m_bounds(bounds), m_child(child)
+    {
+    }
+
+    std::optional<sf::FloatRect> getCullingBounds() const override
+    {
+        return m_bounds;
+    }
+
+private:
+    void draw(sf::RenderTarget& target, const sf::RenderStates& states) const override
+    {
+        if (m_child)
+            target.draw(*m_child, states);
+    }
+
+    sf::FloatRect       m_bounds;
+    const sf::Drawable* m_child;
+};
+
 TEST_CASE("[Graphics] sf::RenderTarget")
 {
     SECTION("Type traits")
@@ -43,6 +68,15 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getDefaultView().getViewport() == sf::FloatRect({0, 0}, {1, 1}));
         CHECK(renderTarget.getDefaultView().getTransform() == sf::Transform(.002f, 0, -1, 0, -.002f, 1, 0, 0, 1));
         CHECK(!renderTarget.isSrgb());
+        CHECK(!renderTarget.isBatchingEnabled());
+        CHECK(!renderTarget.isVertexStreamingEnabled());
+        CHECK(renderTarget.isCullingEnabled());
+        CHECK(renderTarget.getStatistics().drawnDrawables == 0);
+        CHECK(renderTarget.getStatistics().culledDrawables == 0);
+        CHECK(renderTarget.getStatistics().drawCalls == 0);
+        CHECK(renderTarget.getStatistics().vertices == 0);
+        CHECK(renderTarget.getStatistics().contextSwitches == 0);
+        CHECK(renderTarget.getStatistics().gpuTime == sf::Time::Zero);
     }
 
     SECTION("Set/get view")
@@ -59,6 +93,59 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.setActive());
         CHECK(renderTarget.setActive(false));
         CHECK(renderTarget.setActive(true));
+        CHECK(renderTarget.getStatistics().contextSwitches == 2);
+        renderTarget.resetStatistics();
+        CHECK(renderTarget.getStatistics().contextSwitches == 0);
+    }
+
+    SECTION("Set/get batching enabled")
+    {
+        RenderTarget renderTarget;
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Set/get culling enabled")
+    {
+        RenderTarget renderTarget;
+        renderTarget.setCullingEnabled(false);
+        CHECK(!renderTarget.isCullingEnabled());
+        renderTarget.setCullingEnabled(true);
+        CHECK(renderTarget.isCullingEnabled());
+    }
+
+    SECTION("Culling")
+    {
+        RenderTarget       renderTarget;
+        sf::RectangleShape shape({10, 10});
+
+        shape.setPosition({2000, 2000});
+        renderTarget.draw(shape);
+        CHECK(renderTarget.getStatistics().drawnDrawables == 0);
+        CHECK(renderTarget.getStatistics().culledDrawables == 1);
+
+        shape.setPosition({0, 0});
+        sf::RenderStates states;
+        states.transform.translate({3000, 0});
+        renderTarget.draw(shape, states);
+        CHECK(renderTarget.getStatistics().culledDrawables == 2);
+
+        renderTarget.resetStatistics();
+        CHECK(renderTarget.getStatistics().drawnDrawables == 0);
+        CHECK(renderTarget.getStatistics().culledDrawables == 0);
+
+        // Parts of a drawable which passed the test are not tested again
+        const CulledDrawable child(sf::FloatRect({2000, 2000}, {10, 10}), nullptr);
+        const CulledDrawable parent(sf::FloatRect({0, 0}, {10, 10}), &child);
+        renderTarget.draw(parent);
+        CHECK(renderTarget.getStatistics().drawnDrawables == 2);
+        CHECK(renderTarget.getStatistics().culledDrawables == 0);
+
+        renderTarget.draw(child);
+        CHECK(renderTarget.getStatistics().drawnDrawables == 2);
+        CHECK(renderTarget.getStatistics().culledDrawables == 1);
     }
 
     SECTION("getViewport(const View&)")
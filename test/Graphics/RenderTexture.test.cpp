@@ -1,9 +1,19 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Instance.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
 {
@@ -76,4 +86,189 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         CHECK(renderTexture.create({480, 360}));
         CHECK(renderTexture.getTexture().getSize() == sf::Vector2u(480, 360));
     }
+
+    SECTION("getStatistics()")
+    {
+        sf::RenderTexture renderTexture;
+        CHECK(renderTexture.create({480, 360}));
+        renderTexture.resetStatistics();
+
+        renderTexture.draw(sf::RectangleShape({10, 10}));
+        const sf::RenderTarget::Statistics& statistics = renderTexture.getStatistics();
+        CHECK(statistics.drawnDrawables == 2); // The shape and its vertex array
+        CHECK(statistics.drawCalls == 1);
+        CHECK(statistics.vertices == 6);
+        CHECK(statistics.vertexCacheHits == 0);
+        CHECK(statistics.vertexCacheMisses == 1);
+
+        renderTexture.resetStatistics();
+        CHECK(renderTexture.getStatistics().drawCalls == 0);
+        CHECK(renderTexture.getStatistics().vertices == 0);
+    }
+
+    SECTION("Batching")
+    {
+        const std::array colors = {sf::Color::Red, sf::Color::Green, sf::Color::Blue};
+
+        const auto drawScene = [&colors](sf::RenderTexture& renderTexture)
+        {
+            renderTexture.clear();
+            for (std::size_t i = 0; i < colors.size(); ++i)
+            {
+                sf::RectangleShape shape({10, 16});
+                shape.setPosition({static_cast<float>(i) * 20, 0});
+                shape.setFillColor(colors[i]);
+                renderTexture.draw(shape);
+            }
+        };
+
+        sf::RenderTexture unbatched;
+        REQUIRE(unbatched.create({64, 16}));
+        unbatched.resetStatistics();
+        drawScene(unbatched);
+        unbatched.display();
+        CHECK(unbatched.getStatistics().drawCalls == colors.size());
+
+        sf::RenderTexture batched;
+        REQUIRE(batched.create({64, 16}));
+        batched.setBatchingEnabled(true);
+        batched.resetStatistics();
+        drawScene(batched);
+        CHECK(batched.getStatistics().drawCalls == 0);
+        batched.display();
+        CHECK(batched.getStatistics().drawCalls == 1);
+
+        const sf::Image unbatchedImage = unbatched.getTexture().copyToImage();
+        const sf::Image batchedImage   = batched.getTexture().copyToImage();
+        for (unsigned int x = 0; x < 64; ++x)
+            CHECK(batchedImage.getPixel({x, 8}) == unbatchedImage.getPixel({x, 8}));
+        for (unsigned int i = 0; i < colors.size(); ++i)
+            CHECK(batchedImage.getPixel({i * 20 + 5, 8}) == colors[i]);
+    }
+
+    SECTION("Vertex streaming")
+    {
+        constexpr unsigned int size = 256;
+
+        const auto pixelColor = [](unsigned int x, unsigned int y)
+        { return sf::Color(static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), 128); };
+
+        // One quad per pixel, colored after the coordinates of the pixel
+        const auto makeRow = [&pixelColor](unsigned int y)
+        {
+            std::vector<sf::Vertex> vertices;
+            for (unsigned int x = 0; x < size; ++x)
+            {
+                const sf::Color    color = pixelColor(x, y);
+                const sf::Vector2f topLeft(static_cast<float>(x), static_cast<float>(y));
+                vertices.emplace_back(topLeft, color);
+                vertices.emplace_back(topLeft + sf::Vector2f(1, 0), color);
+                vertices.emplace_back(topLeft + sf::Vector2f(0, 1), color);
+                vertices.emplace_back(topLeft + sf::Vector2f(0, 1), color);
+                vertices.emplace_back(topLeft + sf::Vector2f(1, 0), color);
+                vertices.emplace_back(topLeft + sf::Vector2f(1, 1), color);
+            }
+            return vertices;
+        };
+
+        const auto checkPixels = [&pixelColor](const sf::RenderTexture& renderTexture)
+        {
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            std::size_t     wrongPixels{};
+            for (unsigned int y = 0; y < size; ++y)
+                for (unsigned int x = 0; x < size; ++x)
+                    if (image.getPixel({x, y}) != pixelColor(x, y))
+                        ++wrongPixels;
+            CHECK(wrongPixels == 0);
+        };
+
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({size, size}));
+        renderTexture.setVertexStreamingEnabled(true);
+        if (!renderTexture.isVertexStreamingEnabled())
+            return;
+
+        // 256 rows of 1536 vertices wrap around the whole ring buffer twice, which waits on
+        // the region fences with a persistently mapped buffer and orphans the buffer otherwise
+        std::vector<sf::Vertex> all;
+        renderTexture.clear();
+        renderTexture.resetStatistics();
+        for (unsigned int y = 0; y < size; ++y)
+        {
+            const std::vector<sf::Vertex> row = makeRow(y);
+            renderTexture.draw(row.data(), row.size(), sf::PrimitiveType::Triangles);
+            all.insert(all.end(), row.begin(), row.end());
+        }
+        renderTexture.display();
+        CHECK(renderTexture.getStatistics().drawCalls == size);
+        CHECK(renderTexture.getStatistics().vertices == all.size());
+        checkPixels(renderTexture);
+
+        // Too many vertices to fit in a region, drawn from client-side arrays instead
+        renderTexture.clear();
+        renderTexture.resetStatistics();
+        renderTexture.draw(all.data(), all.size(), sf::PrimitiveType::Triangles);
+        renderTexture.display();
+        CHECK(renderTexture.getStatistics().drawCalls == 1);
+        checkPixels(renderTexture);
+
+        // Streaming keeps working after a fallback draw
+        renderTexture.clear();
+        for (unsigned int y = 0; y < size; ++y)
+        {
+            const std::vector<sf::Vertex> row = makeRow(y);
+            renderTexture.draw(row.data(), row.size(), sf::PrimitiveType::Triangles);
+        }
+        renderTexture.display();
+        checkPixels(renderTexture);
+    }
+
+    SECTION("drawInstanced()")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.create({32, 8}));
+
+        const auto makeQuad = [](const sf::Color& color)
+        {
+            return std::array{sf::Vertex({0, 0}, color),
+                              sf::Vertex({8, 0}, color),
+                              sf::Vertex({0, 8}, color),
+                              sf::Vertex({8, 8}, color)};
+        };
+
+        sf::VertexBuffer quad(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Static);
+        if (!quad.create(4))
+            return;
+        REQUIRE(quad.update(makeQuad(sf::Color::White).data()));
+
+        std::array<sf::Instance, 2> instances;
+        instances[0].color = sf::Color::Red;
+        instances[1].color = sf::Color::Green;
+        instances[1].transform.translate({16, 0});
+
+        const auto drawInstances = [&]()
+        {
+            renderTexture.clear();
+            renderTexture.drawInstanced(quad, instances.data(), instances.size());
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        sf::Image image = drawInstances();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({12, 4}) == sf::Color::Black);
+        CHECK(image.getPixel({20, 4}) == sf::Color::Green);
+
+        // Changed instances must be uploaded again
+        instances[1].color = sf::Color::Blue;
+        image              = drawInstances();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({20, 4}) == sf::Color::Blue);
+
+        // Changed geometry must be read again when instances are expanded on the CPU
+        REQUIRE(quad.update(makeQuad(sf::Color(255, 255, 0)).data()));
+        image = drawInstances();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({20, 4}) == sf::Color::Black);
+    }
 }
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/Window/VideoMode.hpp>
@@ -55,4 +56,22 @@ TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
         texture.update(window);
         CHECK(texture.copyToImage().getPixel(sf::Vector2u(196, 196)) == sf::Color::Blue);
     }
+
+    SECTION("Display through a Window reference flushes the batch")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::ContextSettings());
+        window.setBatchingEnabled(true);
+        window.clear();
+        window.resetStatistics();
+
+        window.draw(sf::RectangleShape({10, 10}));
+        CHECK(window.getStatistics().drawCalls == 0);
+
+        sf::Window& baseWindow = window;
+        baseWindow.display();
+        CHECK(window.getStatistics().drawCalls == 1);
+    }
 }
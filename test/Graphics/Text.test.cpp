@@ -200,4 +200,35 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getGlobalBounds() == Approx(sf::FloatRect({66, 182}, {33, 13})));
         }
     }
+
+    SECTION("Incremental update")
+    {
+        const auto expectedBounds = [&font](const sf::String& string, std::uint32_t style, float letterSpacing)
+        {
+            sf::Text reference(font, string, 18);
+            reference.setStyle(style);
+            reference.setLetterSpacing(letterSpacing);
+            return reference.getLocalBounds();
+        };
+
+        sf::Text text(font, "Test", 18);
+        CHECK(text.getLocalBounds() == expectedBounds("Test", sf::Text::Regular, 1));
+
+        text.setString("Test\nTesting");
+        CHECK(text.getLocalBounds() == expectedBounds("Test\nTesting", sf::Text::Regular, 1));
+
+        text.setString("Te");
+        CHECK(text.getLocalBounds() == expectedBounds("Te", sf::Text::Regular, 1));
+
+        text.setStyle(sf::Text::Italic | sf::Text::Underlined);
+        text.setString("Tea time");
+        CHECK(text.getLocalBounds() == expectedBounds("Tea time", sf::Text::Italic | sf::Text::Underlined, 1));
+
+        text.setLetterSpacing(2);
+        CHECK(text.getLocalBounds() == expectedBounds("Tea time", sf::Text::Italic | sf::Text::Underlined, 2));
+
+        text.setStyle(sf::Text::Bold);
+        text.setString("Tea\r\ntime");
+        CHECK(text.getLocalBounds() == expectedBounds("Tea\r\ntime", sf::Text::Bold, 2));
+    }
 }
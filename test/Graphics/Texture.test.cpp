@@ -6,7 +6,10 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -65,6 +68,150 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(texture.getNativeHandle() != 0);
     }
 
+    SECTION("loadFromFiles()")
+    {
+        std::vector<sf::Texture> textures;
+        CHECK(sf::Texture::loadFromFiles({"Graphics/sfml-logo-big.png", "does/not/exist.png", "Graphics/sfml-logo-big.jpg"},
+                                         textures) == 2);
+        REQUIRE(textures.size() == 3);
+        CHECK(textures[0].getSize() == sf::Vector2u(1001, 304));
+        CHECK(textures[0].getNativeHandle() != 0);
+        CHECK(textures[1].getSize() == sf::Vector2u());
+        CHECK(textures[1].getNativeHandle() == 0);
+        CHECK(textures[2].getSize() == sf::Vector2u(1001, 304));
+        CHECK(textures[2].getNativeHandle() != 0);
+    }
+
+    SECTION("loadFromCompressedMemory()")
+    {
+        const auto write32 = [](std::vector<std::uint8_t>& data, std::size_t offset, std::uint32_t value)
+        {
+            for (std::size_t i = 0; i < 4; ++i)
+                data[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+        };
+
+        sf::Texture texture;
+
+        SECTION("Invalid data")
+        {
+            constexpr std::uint8_t garbage[] = {'n', 'o', 't', ' ', 'a', ' ', 'D', 'D', 'S'};
+            CHECK(!texture.loadFromCompressedMemory(garbage, sizeof(garbage)));
+            CHECK(!texture.loadFromCompressedMemory(nullptr, 0));
+            CHECK(texture.getSize() == sf::Vector2u());
+        }
+
+        SECTION("DDS BC1")
+        {
+            std::vector<std::uint8_t> dds(128 + 8);
+            write32(dds, 0, 0x20534444);   // "DDS "
+            write32(dds, 4, 124);          // Header size
+            write32(dds, 12, 4);           // Height
+            write32(dds, 16, 4);           // Width
+            write32(dds, 76, 32);          // Pixel format size
+            write32(dds, 80, 0x4);         // DDPF_FOURCC
+            write32(dds, 84, 0x31545844);  // "DXT1"
+            write32(dds, 128, 0x001FF800); // Red and blue endpoints
+            write32(dds, 132, 0x55555500); // First row red, other rows blue
+
+            REQUIRE(texture.loadFromCompressedMemory(dds.data(), dds.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({3, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({0, 1}) == sf::Color::Blue);
+            CHECK(image.getPixel({3, 3}) == sf::Color::Blue);
+
+            // Truncated blocks
+            dds.resize(130);
+            CHECK(!texture.loadFromCompressedMemory(dds.data(), dds.size()));
+
+            // Too large, the number of blocks would wrap around in 32 bits
+            dds.resize(136);
+            write32(dds, 16, 0xFFFFFFFD);
+            CHECK(!texture.loadFromCompressedMemory(dds.data(), dds.size()));
+        }
+
+        SECTION("DDS BC3")
+        {
+            std::vector<std::uint8_t> dds(128 + 16);
+            write32(dds, 0, 0x20534444);   // "DDS "
+            write32(dds, 4, 124);          // Header size
+            write32(dds, 12, 4);           // Height
+            write32(dds, 16, 4);           // Width
+            write32(dds, 76, 32);          // Pixel format size
+            write32(dds, 80, 0x4);         // DDPF_FOURCC
+            write32(dds, 84, 0x35545844);  // "DXT5"
+            write32(dds, 128, 0x900000FF); // Opaque and transparent endpoints, first indices
+            write32(dds, 132, 0x24924924); // First row opaque, other rows transparent
+            write32(dds, 136, 0x001FF800); // Red and blue endpoints
+            write32(dds, 140, 0x55555500); // First row red, other rows blue
+
+            REQUIRE(texture.loadFromCompressedMemory(dds.data(), dds.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({3, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({0, 1}) == sf::Color(0, 0, 255, 0));
+            CHECK(image.getPixel({3, 3}) == sf::Color(0, 0, 255, 0));
+        }
+
+        SECTION("DDS BC7")
+        {
+            std::vector<std::uint8_t> dds(148 + 16);
+            write32(dds, 0, 0x20534444);   // "DDS "
+            write32(dds, 4, 124);          // Header size
+            write32(dds, 12, 4);           // Height
+            write32(dds, 16, 4);           // Width
+            write32(dds, 76, 32);          // Pixel format size
+            write32(dds, 80, 0x4);         // DDPF_FOURCC
+            write32(dds, 84, 0x30315844);  // "DX10"
+            write32(dds, 128, 98);         // DXGI_FORMAT_BC7_UNORM
+            write32(dds, 132, 3);          // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+            write32(dds, 140, 1);          // Array size
+            write32(dds, 148, 0x00003FC0); // Mode 6, red endpoint
+            write32(dds, 152, 0xFFFFFC00); // Blue endpoint, opaque alpha
+            write32(dds, 156, 0xFFFF0001); // P-bits, first row using the red endpoint
+            write32(dds, 160, 0xFFFFFFFF); // Other rows using the blue endpoint
+
+            REQUIRE(texture.loadFromCompressedMemory(dds.data(), dds.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color(255, 1, 1));
+            CHECK(image.getPixel({3, 0}) == sf::Color(255, 1, 1));
+            CHECK(image.getPixel({0, 1}) == sf::Color(1, 1, 255));
+            CHECK(image.getPixel({3, 3}) == sf::Color(1, 1, 255));
+        }
+
+        SECTION("KTX2 ETC2")
+        {
+            constexpr std::uint8_t identifier[] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32,
+                                                   0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+            std::vector<std::uint8_t> ktx2(104 + 16);
+            std::copy(std::begin(identifier), std::end(identifier), ktx2.begin());
+            write32(ktx2, 12, 151); // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            write32(ktx2, 16, 1);   // Type size
+            write32(ktx2, 20, 4);   // Width
+            write32(ktx2, 24, 4);   // Height
+            write32(ktx2, 36, 1);   // Face count
+            write32(ktx2, 40, 1);   // Level count
+            write32(ktx2, 80, 104); // Level 0 offset
+            write32(ktx2, 88, 16);  // Level 0 length
+            write32(ktx2, 96, 16);  // Level 0 uncompressed length
+            ktx2[104] = 0xFF;       // Opaque EAC alpha, black ETC2 color
+
+            REQUIRE(texture.loadFromCompressedMemory(ktx2.data(), ktx2.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color(2, 2, 2));
+            CHECK(image.getPixel({3, 3}) == sf::Color(2, 2, 2));
+        }
+    }
+
     SECTION("Copy semantics")
     {
         constexpr std::uint8_t red[] = {0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF};
@@ -161,6 +308,42 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("updateAsync()")
+    {
+        constexpr std::uint8_t yellow[] = {0xFF, 0xFF, 0x00, 0xFF};
+        constexpr std::uint8_t cyan[]   = {0x00, 0xFF, 0xFF, 0xFF};
+
+        sf::Texture texture;
+        CHECK(texture.isUpdateComplete());
+
+        SECTION("Pixels")
+        {
+            REQUIRE(texture.create(sf::Vector2u(1, 1)));
+            texture.updateAsync(yellow);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Yellow);
+        }
+
+        SECTION("Pixels, size and destination")
+        {
+            REQUIRE(texture.create(sf::Vector2u(2, 1)));
+            texture.updateAsync(yellow, sf::Vector2u(1, 1), sf::Vector2u(0, 0));
+            texture.updateAsync(cyan, sf::Vector2u(1, 1), sf::Vector2u(1, 0));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Yellow);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+        }
+
+        SECTION("More updates than staging buffers")
+        {
+            REQUIRE(texture.create(sf::Vector2u(1, 1)));
+            for (int i = 0; i < 8; ++i)
+                texture.updateAsync((i % 2) == 0 ? yellow : cyan);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Cyan);
+        }
+
+        texture.waitForUpdate();
+        CHECK(texture.isUpdateComplete());
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture;
@@ -0,0 +1,139 @@
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureAtlas>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureAtlas atlas;
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(!atlas.contains(0));
+        CHECK(!atlas.isSmooth());
+    }
+
+    SECTION("add()")
+    {
+        sf::TextureAtlas atlas({64, 64});
+
+        SECTION("Empty image")
+        {
+            CHECK(!atlas.add(sf::Image()));
+            CHECK(atlas.getPageCount() == 0);
+        }
+
+        SECTION("Images share a page")
+        {
+            sf::Image image;
+            image.create({10, 20}, sf::Color::Red);
+
+            const auto first  = atlas.add(image);
+            const auto second = atlas.add(image);
+            REQUIRE(first);
+            REQUIRE(second);
+            CHECK(*first != *second);
+            CHECK(atlas.getPageCount() == 1);
+            CHECK(&atlas.getTexture(*first) == &atlas.getTexture(*second));
+            CHECK(atlas.getTextureRect(*first).getSize() == sf::Vector2i(10, 20));
+            CHECK(atlas.getTextureRect(*second).getSize() == sf::Vector2i(10, 20));
+            CHECK(!atlas.getTextureRect(*first).findIntersection(atlas.getTextureRect(*second)));
+
+            const sf::Image pixels = atlas.getTexture(*second).copyToImage();
+            CHECK(pixels.getPixel(sf::Vector2u(atlas.getTextureRect(*second).getPosition())) == sf::Color::Red);
+        }
+
+        SECTION("Page grows")
+        {
+            sf::Image image;
+            image.create({40, 40}, sf::Color::Green);
+
+            const auto first = atlas.add(image);
+            REQUIRE(first);
+            const sf::Texture& texture = atlas.getTexture(*first);
+            const sf::IntRect  rect    = atlas.getTextureRect(*first);
+
+            const auto second = atlas.add(image);
+            REQUIRE(second);
+            CHECK(atlas.getPageCount() == 1);
+            CHECK(&atlas.getTexture(*second) == &texture);
+            CHECK(atlas.getTextureRect(*first) == rect);
+            CHECK(texture.getSize() == sf::Vector2u(128, 128));
+        }
+    }
+
+    SECTION("remove()")
+    {
+        sf::TextureAtlas atlas;
+        sf::Image        image;
+        image.create({8, 8}, sf::Color::Blue);
+
+        const auto id = atlas.add(image);
+        REQUIRE(id);
+        CHECK(atlas.contains(*id));
+        atlas.remove(*id);
+        CHECK(!atlas.contains(*id));
+    }
+
+    SECTION("repack()")
+    {
+        sf::TextureAtlas atlas({32, 32}, 0);
+        sf::Image        small;
+        small.create({8, 8}, sf::Color::Blue);
+        sf::Image big;
+        big.create({24, 24}, sf::Color::Yellow);
+
+        const auto first  = atlas.add(small);
+        const auto second = atlas.add(big);
+        REQUIRE(first);
+        REQUIRE(second);
+        atlas.remove(*first);
+        const sf::Texture& texture = atlas.getTexture(*second);
+
+        CHECK(atlas.repack());
+        CHECK(&atlas.getTexture(*second) == &texture);
+        CHECK(atlas.getPageCount() == 1);
+        CHECK(atlas.contains(*second));
+        CHECK(atlas.getTextureRect(*second) == sf::IntRect({0, 0}, {24, 24}));
+        CHECK(atlas.getTexture(*second).copyToImage().getPixel({0, 0}) == sf::Color::Yellow);
+    }
+
+    SECTION("Set/get smooth")
+    {
+        sf::TextureAtlas atlas;
+        sf::Image        image;
+        image.create({8, 8}, sf::Color::Blue);
+        REQUIRE(atlas.add(image));
+
+        atlas.setSmooth(true);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.getPageTexture(0).isSmooth());
+    }
+
+    SECTION("clear()")
+    {
+        sf::TextureAtlas atlas;
+        sf::Image        image;
+        image.create({8, 8}, sf::Color::Blue);
+        const auto id = atlas.add(image);
+        REQUIRE(id);
+
+        atlas.clear();
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(!atlas.contains(*id));
+    }
+}
@@ -0,0 +1,60 @@
+#include <SFML/Graphics/TextureReadback.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureReadback", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureReadback>);
+    }
+
+    SECTION("Construction")
+    {
+        sf::TextureReadback readback;
+        CHECK(readback.isReady());
+        CHECK(readback.getImage().getSize() == sf::Vector2u());
+    }
+
+    SECTION("Empty texture")
+    {
+        const sf::Texture   texture;
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        CHECK(readback.isReady());
+        CHECK(readback.getImage().getSize() == sf::Vector2u());
+    }
+
+    SECTION("Texture pixels")
+    {
+        constexpr std::uint8_t yellow[] = {0xFF, 0xFF, 0x00, 0xFF};
+        constexpr std::uint8_t cyan[]   = {0x00, 0xFF, 0xFF, 0xFF};
+
+        sf::Texture texture;
+        REQUIRE(texture.create(sf::Vector2u(2, 1)));
+        texture.update(yellow, sf::Vector2u(1, 1), sf::Vector2u(0, 0));
+        texture.update(cyan, sf::Vector2u(1, 1), sf::Vector2u(1, 0));
+
+        sf::TextureReadback readback = texture.copyToImageAsync();
+
+        // Later updates must not affect the readback
+        texture.update(cyan, sf::Vector2u(1, 1), sf::Vector2u(0, 0));
+
+        const sf::Image& image = readback.getImage();
+        CHECK(readback.isReady());
+        CHECK(image.getSize() == sf::Vector2u(2, 1));
+        CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Yellow);
+        CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+
+        // The image is only built once
+        CHECK(&readback.getImage() == &image);
+    }
+}
@@ -0,0 +1,114 @@
+#include <SFML/Graphics/TileMap.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TileMap")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::TileMap>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TileMap tileMap({100, 50}, {16, 8});
+        CHECK(tileMap.getMapSize() == sf::Vector2u(100, 50));
+        CHECK(tileMap.getTileSize() == sf::Vector2f(16, 8));
+        CHECK(tileMap.getChunkSize() == sf::Vector2u(32, 32));
+        CHECK(tileMap.getTexture() == nullptr);
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0, 0}, {1600, 400}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({0, 0}, {1600, 400}));
+    }
+
+    SECTION("Set/get texture")
+    {
+        const sf::Texture texture;
+        sf::TileMap       tileMap({10, 10}, {16, 16}, {4, 4});
+        tileMap.setTexture(&texture);
+        CHECK(tileMap.getTexture() == &texture);
+        tileMap.setTexture(nullptr);
+        CHECK(tileMap.getTexture() == nullptr);
+    }
+
+    SECTION("Global bounds")
+    {
+        sf::TileMap tileMap({10, 10}, {16, 16}, {4, 4});
+        tileMap.setPosition({100, 200});
+        tileMap.setScale({2, 0.5f});
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0, 0}, {160, 160}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({100, 200}, {320, 80}));
+    }
+}
+
+TEST_CASE("[Graphics] sf::TileMap drawing", runDisplayTests())
+{
+    sf::Image image;
+    image.create({2, 1}, sf::Color::Red);
+    image.setPixel({1, 0}, sf::Color::Green);
+    sf::Texture texture;
+    REQUIRE(texture.loadFromImage(image));
+
+    sf::RenderTexture renderTexture;
+    REQUIRE(renderTexture.create({8, 8}));
+
+    sf::TileMap tileMap({100, 100}, {4, 4}, {3, 3});
+    tileMap.setTexture(&texture);
+    for (unsigned int y = 0; y < 100; ++y)
+        for (unsigned int x = 0; x < 100; ++x)
+            tileMap.setTile({x, y}, sf::IntRect({0, 0}, {1, 1}));
+
+    SECTION("Visible tiles")
+    {
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        const sf::Image pixels = renderTexture.getTexture().copyToImage();
+        CHECK(pixels.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(pixels.getPixel({7, 7}) == sf::Color::Red);
+    }
+
+    SECTION("Single tile update")
+    {
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+
+        tileMap.setTile({1, 0}, sf::IntRect({1, 0}, {1, 1}));
+        tileMap.removeTile({0, 1});
+
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        const sf::Image pixels = renderTexture.getTexture().copyToImage();
+        CHECK(pixels.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(pixels.getPixel({5, 0}) == sf::Color::Green);
+        CHECK(pixels.getPixel({0, 5}) == sf::Color::Black);
+        CHECK(pixels.getPixel({5, 5}) == sf::Color::Red);
+    }
+
+    SECTION("Scrolled view")
+    {
+        renderTexture.setView(sf::View(sf::FloatRect({200, 200}, {8, 8})));
+        tileMap.setTile({50, 50}, sf::IntRect({1, 0}, {1, 1}));
+
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        const sf::Image pixels = renderTexture.getTexture().copyToImage();
+        CHECK(pixels.getPixel({0, 0}) == sf::Color::Green);
+        CHECK(pixels.getPixel({5, 5}) == sf::Color::Red);
+    }
+}
@@ -1,6 +1,7 @@
 #include <SFML/Network/SocketSelector.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -23,5 +24,97 @@ TEST_CASE("[Network] sf::SocketSelector")
     {
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadyCount() == 0);
+    }
+
+    SECTION("wait()")
+    {
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::SocketSelector socketSelector;
+        socketSelector.add(socket);
+        CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadyCount() == 0);
+
+        SECTION("Send")
+        {
+            socketSelector.add(socket, sf::SocketSelector::Receive | sf::SocketSelector::Send);
+            CHECK(socketSelector.wait(sf::seconds(1)));
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(socketSelector.isReady(socket, sf::SocketSelector::Send));
+            CHECK(!socketSelector.isReady(socket, sf::SocketSelector::Error));
+            REQUIRE(socketSelector.getReadyCount() == 1);
+            CHECK(socketSelector.getReadiness(0) == sf::SocketSelector::Send);
+
+            socketSelector.add(socket);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+            CHECK(!socketSelector.isReady(socket, sf::SocketSelector::Send));
+        }
+
+        sf::UdpSocket sender;
+        const char    data[] = "ping";
+        const auto    status = sender.send(data, sizeof(data), sf::IpAddress::LocalHost, socket.getLocalPort());
+        REQUIRE(status == sf::Socket::Status::Done);
+
+        CHECK(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadyCount() == 1);
+        CHECK(socketSelector.getReadySocket(0) == &socket);
+        CHECK(socketSelector.getReadiness(0) == sf::SocketSelector::Receive);
+
+        SECTION("Copy")
+        {
+            sf::SocketSelector copy(socketSelector);
+            CHECK(!copy.isReady(socket));
+            CHECK(copy.getReadyCount() == 0);
+            CHECK(copy.wait(sf::seconds(1)));
+            CHECK(copy.isReady(socket));
+        }
+
+        SECTION("remove()")
+        {
+            socketSelector.remove(socket);
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(socketSelector.getReadyCount() == 1);
+            CHECK(socketSelector.getReadySocket(0) == nullptr);
+            CHECK(socketSelector.getReadiness(0) == 0);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+            CHECK(socketSelector.getReadyCount() == 0);
+        }
+
+        SECTION("remove() while visiting the ready sockets")
+        {
+            sf::UdpSocket other;
+            REQUIRE(other.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            REQUIRE(sender.send(data, sizeof(data), sf::IpAddress::LocalHost, other.getLocalPort()) ==
+                    sf::Socket::Status::Done);
+            socketSelector.add(other);
+
+            CHECK(socketSelector.wait(sf::seconds(1)));
+            REQUIRE(socketSelector.getReadyCount() == 2);
+
+            // Removing every visited socket must not skip the next one
+            std::size_t visited = 0;
+            for (std::size_t i = 0; i < socketSelector.getReadyCount(); ++i)
+            {
+                sf::Socket* readySocket = socketSelector.getReadySocket(i);
+                REQUIRE(readySocket != nullptr);
+                socketSelector.remove(*readySocket);
+                ++visited;
+            }
+
+            CHECK(visited == 2);
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(!socketSelector.isReady(other));
+        }
+
+        SECTION("clear()")
+        {
+            socketSelector.clear();
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(socketSelector.getReadyCount() == 0);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        }
     }
 }
@@ -2,10 +2,50 @@
 
 // Other 1st party headers
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+class CountingPacket : public sf::Packet
+{
+public:
+    std::size_t receiveCount{};
+
+protected:
+    void onReceive(const void* data, std::size_t size) override
+    {
+        ++receiveCount;
+        sf::Packet::onReceive(data, size);
+    }
+};
+
+class BufferPacket : public sf::Packet
+{
+public:
+    std::size_t bufferCount{};
+    std::size_t bufferSize{};
+
+protected:
+    void onReceiveBuffer(std::vector<std::byte>&& data) override
+    {
+        ++bufferCount;
+        bufferSize = data.size();
+        sf::Packet::onReceiveBuffer(std::move(data));
+    }
+};
+} // namespace
 
 TEST_CASE("[Network] sf::TcpSocket")
 {
@@ -23,5 +63,133 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(tcpSocket.getLocalPort() == 0);
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
+        CHECK(!tcpSocket.isReceiveBuffered());
+    }
+
+    SECTION("send(Packet*, std::size_t)/receive(Packet&)")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        SECTION("Blocking")
+        {
+            std::array<sf::Packet, 3> packets;
+            packets[0] << std::uint32_t{42};
+            packets[2] << std::string("SFML");
+            CHECK(client.send(packets.data(), packets.size()) == sf::Socket::Status::Done);
+            CHECK(client.send(packets[0]) == sf::Socket::Status::Done);
+
+            sf::Packet    packet;
+            std::uint32_t number = 0;
+            std::string   string;
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> number));
+            CHECK(number == 42);
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet.getDataSize() == 0);
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> string));
+            CHECK(string == "SFML");
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> number));
+            CHECK(number == 42);
+        }
+
+        SECTION("Buffered receive")
+        {
+            server.setReceiveBuffered(true);
+            CHECK(server.isReceiveBuffered());
+
+            std::vector<sf::Packet> packets(100);
+            for (std::size_t i = 0; i < packets.size(); ++i)
+                packets[i] << static_cast<std::uint32_t>(i);
+            packets.back().clear();
+            REQUIRE(client.send(packets.data(), packets.size()) == sf::Socket::Status::Done);
+
+            const std::vector<std::uint8_t> large(200 * 1024, 7);
+            sf::Packet                      largePacket;
+            largePacket.append(large.data(), large.size());
+            REQUIRE(client.send(largePacket) == sf::Socket::Status::Done);
+            REQUIRE(client.send(packets[1]) == sf::Socket::Status::Done);
+
+            for (std::size_t i = 0; i < packets.size() - 1; ++i)
+            {
+                sf::Packet    packet;
+                std::uint32_t number = 0;
+                REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+                CHECK((packet >> number));
+                CHECK(number == i);
+            }
+
+            CountingPacket packet;
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet.getDataSize() == 0);
+            CHECK(packet.receiveCount == 0);
+
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet.getDataSize() == large.size());
+            CHECK(packet.receiveCount == 1);
+
+            std::uint32_t number = 0;
+            REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> number));
+            CHECK(number == 1);
+            CHECK(packet.receiveCount == 2);
+
+            // Packets which take the receive buffer over only see the large ones, which don't fit in our buffer
+            REQUIRE(client.send(packets[2]) == sf::Socket::Status::Done);
+            REQUIRE(client.send(largePacket) == sf::Socket::Status::Done);
+
+            BufferPacket bufferPacket;
+            REQUIRE(server.receive(bufferPacket) == sf::Socket::Status::Done);
+            CHECK(bufferPacket.getDataSize() == sizeof(std::uint32_t));
+            CHECK(bufferPacket.bufferCount == 0);
+
+            REQUIRE(server.receive(bufferPacket) == sf::Socket::Status::Done);
+            CHECK(bufferPacket.getDataSize() == large.size());
+            CHECK(bufferPacket.bufferCount == 1);
+            CHECK(bufferPacket.bufferSize == large.size());
+            CHECK(std::memcmp(bufferPacket.getData(), large.data(), large.size()) == 0);
+        }
+
+        SECTION("Non-blocking")
+        {
+            // Large enough to fill the socket buffers, so that sends are partial
+            std::vector<sf::Packet> packets(4);
+            for (std::size_t i = 0; i < packets.size(); ++i)
+            {
+                const std::vector<std::uint8_t> data(1024 * 1024, static_cast<std::uint8_t>(i));
+                packets[i].append(data.data(), data.size());
+            }
+
+            client.setBlocking(false);
+            server.setBlocking(false);
+
+            sf::Socket::Status status   = client.send(packets.data(), packets.size());
+            std::size_t        received = 0;
+            while (received < packets.size())
+            {
+                if (status == sf::Socket::Status::Partial || status == sf::Socket::Status::NotReady)
+                    status = client.send(packets.data(), packets.size());
+                REQUIRE(status != sf::Socket::Status::Error);
+
+                sf::Packet packet;
+                if (server.receive(packet) == sf::Socket::Status::Done)
+                {
+                    REQUIRE(packet.getDataSize() == packets[received].getDataSize());
+                    const auto* data = static_cast<const std::uint8_t*>(packet.getData());
+                    CHECK(data[0] == received);
+                    CHECK(data[packet.getDataSize() - 1] == received);
+                    ++received;
+                }
+            }
+
+            CHECK(status == sf::Socket::Status::Done);
+        }
     }
 }
@@ -1,9 +1,16 @@
 #include <SFML/Network/UdpSocket.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
 #include <type_traits>
 
+#include <cstdint>
+
 TEST_CASE("[Network] sf::UdpSocket")
 {
     SECTION("Type traits")
@@ -35,4 +42,91 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("Batched send()/receive()")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short port = receiver.getLocalPort();
+
+        sf::UdpSocket sender;
+        std::size_t   count = 0;
+
+        SECTION("Raw data")
+        {
+            std::array<char, 4> data = {'S', 'F', 'M', 'L'};
+
+            std::array<sf::UdpSocket::Datagram, 3> datagrams;
+            datagrams[0] = {data.data(), 4, 0, sf::IpAddress::LocalHost, port};
+            datagrams[1] = {data.data(), 0, 0, sf::IpAddress::LocalHost, port};
+            datagrams[2] = {data.data(), 2, 0, sf::IpAddress::LocalHost, port};
+            CHECK(sender.send(datagrams.data(), datagrams.size(), count) == sf::Socket::Status::Done);
+            CHECK(count == 3);
+
+            datagrams[0].remoteAddress.reset();
+            CHECK(sender.send(datagrams.data(), datagrams.size(), count) == sf::Socket::Status::Error);
+            CHECK(count == 0);
+
+            std::array<std::array<char, 16>, 8>     buffers{};
+            std::array<sf::UdpSocket::Datagram, 8> received;
+            for (std::size_t i = 0; i < received.size(); ++i)
+                received[i] = {buffers[i].data(), buffers[i].size(), 0, std::nullopt, 0};
+
+            std::size_t total = 0;
+            while (total < 3)
+            {
+                REQUIRE(receiver.receive(received.data() + total, received.size() - total, count) ==
+                        sf::Socket::Status::Done);
+                total += count;
+            }
+
+            CHECK(total == 3);
+            CHECK(received[0].received == 4);
+            CHECK(std::string(buffers[0].data(), 4) == "SFML");
+            CHECK(received[0].remoteAddress == sf::IpAddress::LocalHost);
+            CHECK(received[0].remotePort == sender.getLocalPort());
+            CHECK(received[1].received == 0);
+            CHECK(received[2].received == 2);
+            CHECK(std::string(buffers[2].data(), 2) == "SF");
+
+            receiver.setBlocking(false);
+            CHECK(receiver.receive(received.data(), received.size(), count) == sf::Socket::Status::NotReady);
+            CHECK(count == 0);
+        }
+
+        SECTION("Packets")
+        {
+            std::array<sf::Packet, 20> packets;
+            for (std::size_t i = 0; i < packets.size(); ++i)
+                packets[i] << static_cast<std::uint32_t>(i);
+
+            std::array<sf::UdpSocket::PacketDatagram, 20> datagrams;
+            for (std::size_t i = 0; i < datagrams.size(); ++i)
+                datagrams[i] = {&packets[i], sf::IpAddress::LocalHost, port};
+            CHECK(sender.send(datagrams.data(), datagrams.size(), count) == sf::Socket::Status::Done);
+            CHECK(count == datagrams.size());
+
+            std::array<sf::Packet, 20>                    receivedPackets;
+            std::array<sf::UdpSocket::PacketDatagram, 20> received;
+            for (std::size_t i = 0; i < received.size(); ++i)
+                received[i].packet = &receivedPackets[i];
+
+            std::size_t total = 0;
+            while (total < received.size())
+            {
+                REQUIRE(receiver.receive(received.data() + total, received.size() - total, count) ==
+                        sf::Socket::Status::Done);
+                total += count;
+            }
+
+            for (std::size_t i = 0; i < received.size(); ++i)
+            {
+                std::uint32_t number = 0;
+                CHECK((receivedPackets[i] >> number));
+                CHECK(number == i);
+                CHECK(received[i].remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(received[i].remotePort == sender.getLocalPort());
+            }
+        }
+    }
 }
@@ -0,0 +1,116 @@
+#include <SFML/System/Archive.hpp>
+
+// Other 1st party headers
+#include <SFML/System/ArchiveInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace
+{
+void writeFile(const std::filesystem::path& path, const std::string& contents)
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path, std::ios_base::binary) << contents;
+}
+
+std::string readEntry(const sf::Archive& archive, const std::filesystem::path& name)
+{
+    sf::ArchiveInputStream stream;
+    if (!stream.open(archive, name))
+        return "<missing>";
+
+    std::string contents(static_cast<std::size_t>(stream.getSize()), '\0');
+    if (stream.read(contents.data(), stream.getSize()) != stream.getSize())
+        return "<error>";
+
+    return contents;
+}
+} // namespace
+
+TEST_CASE("[System] sf::Archive")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Archive>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Archive>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Archive>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Archive>);
+
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ArchiveInputStream>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ArchiveInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ArchiveInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ArchiveInputStream>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::Archive archive;
+        CHECK(archive.getEntryCount() == 0);
+        CHECK(!archive.contains("file.txt"));
+
+        sf::ArchiveInputStream stream;
+        CHECK(stream.read(nullptr, 0) == -1);
+        CHECK(stream.seek(0) == -1);
+        CHECK(stream.tell() == -1);
+        CHECK(stream.getSize() == -1);
+        CHECK(!stream.open(archive, "file.txt"));
+    }
+
+    SECTION("Invalid file")
+    {
+        sf::Archive archive;
+        CHECK(!archive.open("does/not/exist.pak"));
+        CHECK(!archive.open("System/Archive.test.cpp"));
+        CHECK(archive.getEntryCount() == 0);
+    }
+
+    const std::filesystem::path directory   = std::filesystem::temp_directory_path() / "sfmlarchivetemp";
+    const std::filesystem::path archivePath = std::filesystem::temp_directory_path() / "sfmlarchivetemp.pak";
+    const std::string           repeated(10'000, 'a');
+
+    writeFile(directory / "hello.txt", "Hello world");
+    writeFile(directory / "sub" / "repeated.txt", repeated);
+    writeFile(directory / "sub" / "empty.txt", "");
+
+    for (const bool compress : {false, true})
+    {
+        REQUIRE(sf::Archive::create(archivePath, directory, compress));
+
+        sf::Archive archive;
+        REQUIRE(archive.open(archivePath));
+        CHECK(archive.getEntryCount() == 3);
+        CHECK(archive.contains("hello.txt"));
+        CHECK(archive.contains("sub/repeated.txt"));
+        CHECK(archive.contains("sub/empty.txt"));
+        CHECK(!archive.contains("repeated.txt"));
+
+        CHECK(readEntry(archive, "hello.txt") == "Hello world");
+        CHECK(readEntry(archive, "sub/repeated.txt") == repeated);
+        CHECK(readEntry(archive, "sub/empty.txt").empty());
+        CHECK(readEntry(archive, "missing.txt") == "<missing>");
+
+        // Compression only applies to the entries which shrink
+        CHECK((std::filesystem::file_size(archivePath) < repeated.size()) == compress);
+
+        sf::ArchiveInputStream stream;
+        REQUIRE(stream.open(archive, "hello.txt"));
+        char buffer[32];
+        CHECK(stream.getSize() == 11);
+        CHECK(stream.seek(6) == 6);
+        CHECK(stream.read(buffer, 32) == 5);
+        CHECK(std::string_view(buffer, 5) == "world");
+        CHECK(stream.tell() == 11);
+
+        const sf::ArchiveInputStream movedStream = std::move(stream);
+        CHECK(stream.getSize() == -1); // NOLINT(bugprone-use-after-move)
+    }
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::remove(archivePath);
+}